@@ -71,6 +71,17 @@ ACADOcsparse::ACADOcsparse(const ACADOcsparse &arg)
 	index1 = 0;
 	index2 = 0;
 
+	if (arg.index1 != 0 && arg.index2 != 0)
+	{
+		index1 = new int[nDense];
+		index2 = new int[nDense];
+		for (run1 = 0; run1 < nDense; run1++)
+		{
+			index1[run1] = arg.index1[run1];
+			index2[run1] = arg.index2[run1];
+		}
+	}
+
 	if (arg.x == 0)
 		x = 0;
 	else
@@ -96,21 +107,7 @@ ACADOcsparse::~ACADOcsparse()
 	if (x != 0)
 		delete[] x;
 
-	if (S != 0)
-		cs_free(S);
-	if (N != 0)
-	{
-
-		if (N->L != 0)
-			cs_spfree(N->L);
-		if (N->U != 0)
-			cs_spfree(N->U);
-		if (N->pinv != 0)
-			free(N->pinv);
-		if (N->B != 0)
-			free(N->B);
-		free(N);
-	}
+	clearSymbolic();
 }
 
 ACADOcsparse* ACADOcsparse::clone() const
@@ -127,7 +124,7 @@ returnValue ACADOcsparse::solve(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
@@ -148,7 +145,7 @@ returnValue ACADOcsparse::solveTranspose(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
@@ -188,6 +185,9 @@ returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
 	if (index2 != 0)
 		delete[] index2;
 
+	// A NEW SPARSITY PATTERN REQUIRES A NEW SYMBOLIC ANALYSIS:
+	clearSymbolic();
+
 	int run1;
 
 	index1 = new int[nDense];
@@ -204,13 +204,16 @@ returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
 returnValue ACADOcsparse::setMatrix(double *A_)
 {
 	int run1;
-	int order = 0;
+	int order = 1; // approximate minimum degree ordering of A+A'
 
 	if (dim <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
+	if (index1 == 0 || index2 == 0)
+		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
 	cs *C, *D;
 	C = cs_spalloc(0, 0, 1, 1, 1);
 
@@ -218,12 +221,22 @@ returnValue ACADOcsparse::setMatrix(double *A_)
 		cs_entry(C, index1[run1], index2[run1], A_[run1]);
 
 	D = cs_compress(C);
-	S = cs_sqr(order, D, 0);
-	N = cs_lu(D, S, TOL);
+
+	// THE SYMBOLIC ANALYSIS (FILL-REDUCING ORDERING) ONLY DEPENDS ON
+	// THE SPARSITY PATTERN AND IS REUSED FOR ALL FURTHER MATRICES:
+	if (S == 0)
+		S = cs_sqr(order, D, 0);
+
+	clearNumeric();
+	if (S != 0)
+		N = cs_lu(D, S, TOL);
 
 	cs_spfree(C);
 	cs_spfree(D);
 
+	if (S == 0 || N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -248,6 +261,26 @@ returnValue ACADOcsparse::setPrintLevel(PrintLevel printLevel_)
 	return SUCCESSFUL_RETURN;
 }
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void ACADOcsparse::clearSymbolic()
+{
+	clearNumeric();
+
+	if (S != 0)
+		cs_sfree(S);
+	S = 0;
+}
+
+void ACADOcsparse::clearNumeric()
+{
+	if (N != 0)
+		cs_nfree(N);
+	N = 0;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 #else // __MATLAB__
@@ -168,6 +168,11 @@ class ACADOcsparse : public SparseSolver{
     //
     protected:
 
+        /** Frees the symbolic analysis and the numeric factorization. */
+        void clearSymbolic( );
+
+        /** Frees the numeric factorization. */
+        void clearNumeric( );
 
 
     //
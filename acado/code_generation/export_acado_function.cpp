@@ -50,10 +50,12 @@ ExportAcadoFunction::ExportAcadoFunction( ) : ExportFunction( )
 	numP = 0;
 	numDX = 0;
 	numOD = 0;
+	numPoints = 0;
 
 	f = std::shared_ptr< Function >(new Function( ));
 
 	external = false;
+	singlePrecision = false;
 }
 
 
@@ -96,6 +98,7 @@ returnValue ExportAcadoFunction::init(	const Function& _f,
 	numP = _numP;
 	numDX = _numDX;
 	numOD = _numOD;
+	numPoints = 0;
 
 	f = std::shared_ptr< Function >(new Function( _f ));
 
@@ -103,6 +106,7 @@ returnValue ExportAcadoFunction::init(	const Function& _f,
 	f->setGlobalExportVariableName( globalVar.getFullName() );
 
 	external = false;
+	singlePrecision = false;
 
 	// Just add two dummy arguments in order to keep addFunctionCall function happy.
 	return ExportFunction::init(_name, ExportArgument("input", 1, 1), ExportArgument("output", 1, 1));
@@ -116,7 +120,7 @@ returnValue ExportAcadoFunction::exportDataDeclaration(	std::ostream& stream,
 {
 	ASSERT( external == false );
 
-	stream	<< _realString << " " << f->getGlobalExportVariableName()
+	stream	<< (singlePrecision == true ? "float" : _realString) << " " << f->getGlobalExportVariableName()
 			<< "[ " << f->getGlobalExportVariableSize( ) << " ];" << std::endl;
 
 	return SUCCESSFUL_RETURN;
@@ -134,6 +138,10 @@ returnValue ExportAcadoFunction::exportForwardDeclaration(	std::ostream& stream,
 
 	if (external == true)
 	{
+		if (ExportArgumentList::hasContextArgument() == true)
+			return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+					"External functions cannot be called from reentrant code.");
+
 		stream << endl;
 		stream << "/** An external function for evaluation of symbolic expressions. */" << endl;
 		stream << "void " << name << "(const " << _realString << "* in, " << _realString << "* out);" << endl;
@@ -141,7 +149,15 @@ returnValue ExportAcadoFunction::exportForwardDeclaration(	std::ostream& stream,
 		return SUCCESSFUL_RETURN;
 	}
 
-	return f->exportForwardDeclarations(stream, name.c_str(), _realString.c_str());
+	f->setExportContextArgument( ExportArgumentList::getContextArgument( true ) );
+
+	const std::string realString = singlePrecision == true ? "float" : _realString;
+
+	returnValue status = f->exportForwardDeclarations(stream, name.c_str(), realString.c_str());
+	if (status != SUCCESSFUL_RETURN || numPoints == 0)
+		return status;
+
+	return f->exportForwardDeclarations(stream, getBatchName().c_str(), realString.c_str());
 }
 
 
@@ -154,10 +170,22 @@ returnValue ExportAcadoFunction::exportCode(	std::ostream& stream,
 	if (external == true)
 		return SUCCESSFUL_RETURN;
 
-	return f->exportCode(
-			stream, name.c_str(), _realString.c_str(), numX, numXA, numU, numP, numDX, numOD,
+	// In reentrant code, the intermediate values are kept in the context
+	f->setExportContextArgument( ExportArgumentList::getContextArgument( true ) );
+
+	const std::string realString = singlePrecision == true ? "float" : _realString;
+
+	returnValue status = f->exportCode(
+			stream, name.c_str(), realString.c_str(), numX, numXA, numU, numP, numDX, numOD,
 			// TODO: Here we allocate local memory for the function, this should be extended.
 			false, false);
+	if (status != SUCCESSFUL_RETURN || numPoints == 0)
+		return status;
+
+	// The batched variant keeps its intermediate values of all points on the stack
+	return f->exportBatchCode(
+			stream, getBatchName().c_str(), realString.c_str(), numPoints,
+			numX, numXA, numU, numP, numDX, numOD, true, false);
 }
 
 
@@ -205,4 +233,44 @@ bool ExportAcadoFunction::isExternal() const
 	return external;
 }
 
+returnValue ExportAcadoFunction::setNumberOfPoints( unsigned _numPoints )
+{
+	if (external == true && _numPoints > 0)
+		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "External functions cannot be batched.");
+
+	numPoints = _numPoints;
+
+	return SUCCESSFUL_RETURN;
+}
+
+unsigned ExportAcadoFunction::getNumberOfPoints( ) const
+{
+	return numPoints;
+}
+
+std::string ExportAcadoFunction::getBatchName( ) const
+{
+	return name + "Batch";
+}
+
+returnValue ExportAcadoFunction::setSinglePrecision( bool _singlePrecision )
+{
+	if (external == true && _singlePrecision == true)
+		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "External functions cannot be evaluated in single precision.");
+
+	singlePrecision = _singlePrecision;
+
+	// The intermediate values are kept apart from the ones of the double precision functions
+	globalVar.setup(singlePrecision == true ? "acado_aux_single" : "acado_aux",
+			f->getGlobalExportVariableSize(), 1, singlePrecision == true ? REAL_SINGLE : REAL, ACADO_WORKSPACE);
+	f->setGlobalExportVariableName( globalVar.getFullName() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+bool ExportAcadoFunction::isSinglePrecision( ) const
+{
+	return singlePrecision;
+}
+
 CLOSE_NAMESPACE_ACADO
@@ -174,6 +174,35 @@ public:
 	/** A helper function to check whether a function is external. */
 	bool isExternal() const;
 
+	/** Sets the number of points of the batched variant of the function.
+	 *
+	 *  If the number of points is positive, a function with name getBatchName()
+	 *  is exported additionally, which evaluates all points at once. Its inputs
+	 *  and outputs are stored point-wise contiguous, i.e. component i of point k
+	 *  is located at in[i * numPoints + k] and out[i * numPoints + k].
+	 *
+	 *	@param[in] _numPoints	Number of points, 0 disables the batched variant.
+	 */
+	returnValue setNumberOfPoints( unsigned _numPoints );
+
+	/** Get the number of points of the batched variant of the function. */
+	unsigned getNumberOfPoints( ) const;
+
+	/** Get the name of the batched variant of the function. */
+	std::string getBatchName( ) const;
+
+	/** Sets whether the function is evaluated in single precision.
+	 *
+	 *  The function and its intermediate values are then of type float,
+	 *  regardless of the floating point type of the exported file.
+	 *
+	 *	@param[in] _singlePrecision	True for evaluation in single precision.
+	 */
+	returnValue setSinglePrecision( bool _singlePrecision );
+
+	/** A helper function to check whether the function is evaluated in single precision. */
+	bool isSinglePrecision( ) const;
+
 protected:
 	/** The number of states that are needed to evaluate the system of differential equations.
 	 *  If this number isn't specified, then it will be set to the number of equations (minus
@@ -192,12 +221,16 @@ protected:
 	unsigned numDX;
 	/** The number of "online data" objects. */
 	unsigned numOD;
+	/** The number of points of the batched variant, 0 if there is none. */
+	unsigned numPoints;
 	/** ACADO function to be exported. */
 	std::shared_ptr< Function > f;
 	/** A variable that holds intermediate values. */
 	ExportVariable globalVar;
 	/** Flag indicating whether the symbolic function is external or not. */
 	bool external;
+	/** Flag indicating whether the function is evaluated in single precision. */
+	bool singlePrecision;
 };
 
 CLOSE_NAMESPACE_ACADO
@@ -251,6 +251,7 @@ returnValue ExportArgumentInternal::exportDataDeclaration(	std::ostream& stream,
 			break;
 
 		case REAL:
+		case REAL_SINGLE:
 //		case STATIC_CONST_REAL:
 			data->print(stream, "", "{ ", " };\n", 1, 16, ", ", ", \n");
 			break;
@@ -37,6 +37,9 @@
 BEGIN_NAMESPACE_ACADO
 
 
+bool ExportArgumentList::useContext = false;
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -133,6 +136,13 @@ returnValue ExportArgumentList::exportCode(	std::ostream& stream,
 											) const
 {
 	bool started = false;
+
+	if (useContext == true)
+	{
+		stream << getContextArgument( includeType );
+		started = true;
+	}
+
 	for (unsigned i = 0; i < arguments.size(); ++i)
 	{
 		// Allow only undefined arguments and defined integer scalars
@@ -143,7 +153,7 @@ returnValue ExportArgumentList::exportCode(	std::ostream& stream,
 				)
 			continue;
 
-		if (i > 0 && started == true)
+		if (started == true)
 			stream << ", ";
 
 		if ( includeType == true )
@@ -214,6 +224,34 @@ const std::vector< ExportArgument >& ExportArgumentList::get() const
 }
 
 
+returnValue ExportArgumentList::setContextArgument(	bool _useContext
+													)
+{
+	useContext = _useContext;
+	return SUCCESSFUL_RETURN;
+}
+
+
+bool ExportArgumentList::hasContextArgument( )
+{
+	return useContext;
+}
+
+
+std::string ExportArgumentList::getContextArgument(	bool _includeType,
+													const std::string& _separator
+													)
+{
+	if (useContext == false)
+		return std::string();
+
+	if (_includeType == true)
+		return std::string("ACADOcontext* acadoContext") + _separator;
+
+	return std::string("acadoContext") + _separator;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
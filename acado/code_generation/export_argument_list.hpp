@@ -180,6 +180,34 @@ class ExportArgumentList
 		 */
 		const std::vector< ExportArgument >& get( ) const;
 
+
+		/** Specifies whether all exported argument lists start with the pointer
+		 *  to the context of the solver instance, i.e. whether reentrant code is
+		 *  exported. The setting applies to all argument lists.
+		 *
+		 *	@param[in] _useContext		Flag indicating whether to pass the context.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		static returnValue setContextArgument(	bool _useContext
+												);
+
+		/** Returns whether all exported argument lists start with the context. */
+		static bool hasContextArgument( );
+
+		/** Returns the context argument of a function declaration (or, if types
+		 *  are not to be included, of a function call), followed by the given
+		 *  separator. If no context is passed, an empty string is returned.
+		 *
+		 *	@param[in] _includeType		Flag indicating whether to include the type.
+		 *	@param[in] _separator		Separator from the following arguments.
+		 *
+		 *	\return Context argument
+		 */
+		static std::string getContextArgument(	bool _includeType = false,
+												const std::string& _separator = ""
+												);
+
 	//
 	// PROTECTED MEMBER FUNCTIONS:
 	//
@@ -205,6 +233,9 @@ class ExportArgumentList
 		
 		/** Flag indicating whether variable types are to be included in calling arguments. */
 		bool includeType;
+
+		/** Flag indicating whether argument lists start with the context of the solver instance. */
+		static bool useContext;
 };
 
 
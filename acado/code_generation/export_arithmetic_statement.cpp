@@ -39,6 +39,20 @@
 using namespace std;
 BEGIN_NAMESPACE_ACADO
 
+bool ExportArithmeticStatement::useBlockedMultiplication = true;
+unsigned ExportArithmeticStatement::unrollingBudget = 0;
+unsigned ExportArithmeticStatement::unrolledStatements = 0;
+unsigned ExportArithmeticStatement::maxUnrolledStatements = 0;
+
+//
+// Sizes of the blocked multiplication kernels: each block computes
+// BLOCK_ROWS x BLOCK_COLS entries of the result, and columns of rhs2 are
+// processed in panels that fit into (roughly) BLOCK_CACHE_SIZE bytes.
+//
+static const unsigned BLOCK_ROWS = 4;
+static const unsigned BLOCK_COLS = 4;
+static const unsigned BLOCK_CACHE_SIZE = 32768;
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -204,7 +218,8 @@ returnValue ExportArithmeticStatement::exportCodeAddSubtract(	std::ostream& stre
 	//
 	bool optimizationsAllowed = ( rhs1->isGiven() == false ) && ( rhs2->isGiven() == false );
 
-	if (numberOfFlops < 4096 || optimizationsAllowed == false)
+	if (optimizationsAllowed == false ||
+			(numberOfFlops < 4096 && acquireUnrollingBudget( numberOfFlops ) == true))
 	{
 		for( uint i=0; i<getNumRows( ); ++i )
 			for( uint j=0; j<getNumCols( ); ++j )
@@ -251,10 +266,10 @@ returnValue ExportArithmeticStatement::exportCodeAddSubtract(	std::ostream& stre
 		for(unsigned j = 0; j < getNumCols( ); ++j)
 		{
 			stream << lhs->get(ii, j) << " " << getAssignString();
-			stream  << " " << _sign << " " << rhs2->get(ii, j) << ";\n";
+			stream << " " << rhs1->get(ii, j) << " " << _sign << " " << rhs2->get(ii, j) << ";\n";
 		}
 
-		stream << "\n{\n";
+		stream << "\n}\n";
 
 		memAllocator->release( ii );
 	}
@@ -273,7 +288,7 @@ returnValue ExportArithmeticStatement::exportCodeAddSubtract(	std::ostream& stre
 				<< "++" << jj.getName() << ")\n{\n";
 
 		stream	<< lhs->get(ii, jj) << " " <<  getAssignString()
-				<< _sign << " " << rhs2->get(ii, jj) << ";\n";
+				<< " " << rhs1->get(ii, jj) << " " << _sign << " " << rhs2->get(ii, jj) << ";\n";
 
 		stream	<< "\n}\n"
 				<< "\n}\n";
@@ -342,10 +357,22 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 	if (op2 == ESO_ADD || op2 == ESO_SUBTRACT)
 		optimizationsAllowed &= rhs3.isGiven() == false;
 
+	//
+	// Blocked kernels pay off once the result has at least one full block,
+	// they are already preferred over unrolled code for moderate sizes
+	//
+	bool blockingAllowed =
+			useBlockedMultiplication == true && optimizationsAllowed == true &&
+			lhs.isCalledByValue() == false &&
+			getNumRows() >= BLOCK_ROWS && getNumCols() >= BLOCK_COLS;
+
+	unsigned maxUnrolledFlops = blockingAllowed == true ? 1024 : 4096;
+
 	//
 	// Depending on the flops count different export strategies are performed
 	//
-	if (numberOfFlops < 4096 || optimizationsAllowed == false)
+	if (optimizationsAllowed == false ||
+			(numberOfFlops < maxUnrolledFlops && acquireUnrollingBudget(getNumRows() * getNumCols()) == true))
 	{
 		//
 		// Unroll all loops
@@ -476,6 +503,100 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 //
 //		memAllocator->release( ii );
 //	}
+	else if (blockingAllowed == true)
+	{
+		//
+		// Register-blocked kernels, the remaining rows and columns are
+		// handled by smaller blocks
+		//
+
+		uint nRowsBlocked = getNumRows() - getNumRows() % BLOCK_ROWS;
+		uint nColsBlocked = getNumCols() - getNumCols() % BLOCK_COLS;
+		uint nRowsLeft = getNumRows() - nRowsBlocked;
+		uint nColsLeft = getNumCols() - nColsBlocked;
+
+		//
+		// Columns of rhs2 are processed in panels which fit into the cache
+		//
+		uint nColsPanel = BLOCK_CACHE_SIZE / (sizeof( double ) * nColsRhs1);
+		nColsPanel -= nColsPanel % BLOCK_COLS;
+		if (nColsPanel < BLOCK_COLS)
+			nColsPanel = BLOCK_COLS;
+
+		ExportIndex pp;
+		bool usePanels = nColsBlocked > nColsPanel;
+
+		memAllocator->acquire( ii );
+		memAllocator->acquire( jj );
+		memAllocator->acquire( kk );
+
+		if (usePanels == true)
+		{
+			memAllocator->acquire( pp );
+
+			stream << "for (" << pp.getName() << " = 0; ";
+			stream << pp.getName() << " < " << nColsBlocked << "; ";
+			stream << pp.getName() << " += " << nColsPanel << ")\n{\n";
+		}
+
+		stream << "for (" << ii.getName() << " = 0; ";
+		stream << ii.getName() << " < " << nRowsBlocked << "; ";
+		stream << ii.getName() << " += " << BLOCK_ROWS << ")\n{\n";
+
+		if (usePanels == true)
+		{
+			stream << "for (" << jj.getName() << " = " << pp.getName() << "; ";
+			stream << jj.getName() << " < " << nColsBlocked << " && ";
+			stream << jj.getName() << " < " << pp.getName() << " + " << nColsPanel << "; ";
+		}
+		else
+		{
+			stream << "for (" << jj.getName() << " = 0; ";
+			stream << jj.getName() << " < " << nColsBlocked << "; ";
+		}
+		stream << jj.getName() << " += " << BLOCK_COLS << ")\n{\n";
+
+		exportCodeMultiplyBlock(stream, transposeRhs1, ii, jj, kk, BLOCK_ROWS, BLOCK_COLS, _realString);
+
+		stream << "}\n";
+		stream << "}\n";
+
+		if (usePanels == true)
+		{
+			stream << "}\n";
+
+			memAllocator->release( pp );
+		}
+
+		if (nColsLeft > 0)
+		{
+			stream << "for (" << ii.getName() << " = 0; ";
+			stream << ii.getName() << " < " << nRowsBlocked << "; ";
+			stream << ii.getName() << " += " << BLOCK_ROWS << ")\n{\n";
+
+			exportCodeMultiplyBlock(stream, transposeRhs1, ii, ExportIndex( nColsBlocked ), kk, BLOCK_ROWS, nColsLeft, _realString);
+
+			stream << "}\n";
+		}
+
+		if (nRowsLeft > 0)
+		{
+			stream << "for (" << jj.getName() << " = 0; ";
+			stream << jj.getName() << " < " << nColsBlocked << "; ";
+			stream << jj.getName() << " += " << BLOCK_COLS << ")\n{\n";
+
+			exportCodeMultiplyBlock(stream, transposeRhs1, ExportIndex( nRowsBlocked ), jj, kk, nRowsLeft, BLOCK_COLS, _realString);
+
+			stream << "}\n";
+		}
+
+		if (nRowsLeft > 0 && nColsLeft > 0)
+			exportCodeMultiplyBlock(stream, transposeRhs1, ExportIndex( nRowsBlocked ), ExportIndex( nColsBlocked ), kk, nRowsLeft, nColsLeft, _realString);
+
+		memAllocator->release( ii );
+		memAllocator->release( jj );
+		memAllocator->release( kk );
+	}
 	else
 	{
 		//
@@ -545,6 +666,76 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 }
 
 
+returnValue ExportArithmeticStatement::exportCodeMultiplyBlock(	std::ostream& stream,
+																bool transposeRhs1,
+																const ExportIndex& _ii,
+																const ExportIndex& _jj,
+																const ExportIndex& _kk,
+																uint _nRows,
+																uint _nCols,
+																const std::string& _realString
+																) const
+{
+	uint nColsRhs1 = transposeRhs1 == false ? rhs1->getNumCols( ) : rhs1->getNumRows( );
+	const char* update = op2 == ESO_SUBTRACT ? " -= " : " += ";
+
+	stream << "{\n";
+
+	//
+	// Accumulators of the block
+	//
+	for (uint i = 0; i < _nRows; ++i)
+	{
+		stream << _realString;
+		for (uint j = 0; j < _nCols; ++j)
+			stream << (j == 0 ? " " : ", ") << "t" << i << "_" << j << " = 0.0";
+		stream << ";\n";
+	}
+
+	stream << "for (" << _kk.getName() << " = 0; ";
+	stream << _kk.getName() << " < " << nColsRhs1 << "; ";
+	stream << "++" << _kk.getName() << ")\n{\n";
+
+	//
+	// Load one column of the rows of rhs1 and one row of the columns of rhs2,
+	// and update all accumulators with their products
+	//
+	for (uint i = 0; i < _nRows; ++i)
+	{
+		stream << _realString << " a" << i << " = ";
+		if (transposeRhs1 == false)
+			stream << rhs1->get(_ii + i, _kk) << ";\n";
+		else
+			stream << rhs1->get(_kk, _ii + i) << ";\n";
+	}
+	for (uint j = 0; j < _nCols; ++j)
+		stream << _realString << " b" << j << " = " << rhs2->get(_kk, _jj + j) << ";\n";
+
+	for (uint i = 0; i < _nRows; ++i)
+		for (uint j = 0; j < _nCols; ++j)
+			stream << "t" << i << "_" << j << update << "a" << i << "*b" << j << ";\n";
+
+	stream << "}\n";
+
+	for (uint i = 0; i < _nRows; ++i)
+		for (uint j = 0; j < _nCols; ++j)
+		{
+			stream << lhs->get(_ii + i, _jj + j) << " " << getAssignString() << " t" << i << "_" << j;
+
+			if (op2 == ESO_ADD)
+				stream << " + " << rhs3->get(_ii + i, _jj + j);
+			else if (op2 == ESO_SUBTRACT)
+				stream << " - " << rhs3->get(_ii + i, _jj + j);
+
+			stream << ";\n";
+		}
+
+	stream << "}\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ExportArithmeticStatement::exportCodeAssign(	std::ostream& stream,
 															const std::string& _op,
 															const std::string& _realString,
@@ -570,7 +761,7 @@ returnValue ExportArithmeticStatement::exportCodeAssign(	std::ostream& stream,
 		stream 	<< "{ int lCopy; for (lCopy = 0; lCopy < "<< lhs.getDim() << "; lCopy++) "
 				<< lhs.getFullName() << "[ lCopy ] = 0; }" << endl;
 	}
-	else if ((numOps < 128) || (rhs1.isGiven() == true))
+	else if (rhs1.isGiven() == true || (numOps < 128 && acquireUnrollingBudget( numOps ) == true))
 	{
 		for(unsigned i = 0; i < lhs.getNumRows( ); ++i)
 			for(unsigned j = 0; j < lhs.getNumCols( ); ++j)
@@ -579,7 +770,7 @@ returnValue ExportArithmeticStatement::exportCodeAssign(	std::ostream& stream,
 					stream << lhs->get(i, j) << " " << _op << " ";
 					if (rhs1->isGiven() == true)
 					{
-						if (lhs->getType() == REAL || lhs->getType() == STATIC_CONST_REAL)
+						if (lhs->getType() == REAL || lhs->getType() == STATIC_CONST_REAL || lhs->getType() == REAL_SINGLE)
 							stream << scientific << rhs1(i, j);
 						else
 							stream << (int)rhs1(i, j);
@@ -664,6 +855,54 @@ ExportArithmeticStatement& ExportArithmeticStatement::allocate( MemoryAllocatorP
 	return *this;
 }
 
+returnValue ExportArithmeticStatement::setBlockedMultiplication(	bool _useBlocking
+																	)
+{
+	useBlockedMultiplication = _useBlocking;
+
+	return SUCCESSFUL_RETURN;
+}
+
+bool ExportArithmeticStatement::hasBlockedMultiplication( )
+{
+	return useBlockedMultiplication;
+}
+
+returnValue ExportArithmeticStatement::setUnrollingBudget(	unsigned _budget
+															)
+{
+	unrollingBudget = _budget;
+	unrolledStatements = 0;
+	maxUnrolledStatements = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ExportArithmeticStatement::resetUnrolledStatements( )
+{
+	unrolledStatements = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+unsigned ExportArithmeticStatement::getMaxUnrolledStatements( )
+{
+	return maxUnrolledStatements;
+}
+
+bool ExportArithmeticStatement::acquireUnrollingBudget(	unsigned _numStatements
+														)
+{
+	if (unrollingBudget > 0 && unrolledStatements + _numStatements > unrollingBudget)
+		return false;
+
+	unrolledStatements += _numStatements;
+	if (unrolledStatements > maxUnrolledStatements)
+		maxUnrolledStatements = unrolledStatements;
+
+	return true;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
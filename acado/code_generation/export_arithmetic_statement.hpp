@@ -131,6 +131,45 @@ class ExportArithmeticStatement : public ExportStatement
 
 		ExportArithmeticStatement& allocate( MemoryAllocatorPtr allocator );
 
+		/** Specifies whether larger matrix multiplications are exported as
+		 *  register-blocked kernels instead of plain triple loops. The setting
+		 *  applies to all arithmetic statements exported afterwards.
+		 *
+		 *	@param[in] _useBlocking		Flag indicating whether to export blocked kernels.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		static returnValue setBlockedMultiplication(	bool _useBlocking
+														);
+
+		/** Returns whether larger matrix multiplications are exported as blocked kernels. */
+		static bool hasBlockedMultiplication( );
+
+		/** Limits the number of scalar statements that are unrolled in one
+		 *  exported function. Operations which would exceed the budget are
+		 *  exported as loops instead. Operations on hard-coded matrices are
+		 *  always unrolled and do not count.
+		 *
+		 *	@param[in] _budget		Maximum number of unrolled statements per function (0: no limit).
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		static returnValue setUnrollingBudget(	unsigned _budget
+												);
+
+		/** Starts the export of a new function, i.e. makes the whole unrolling
+		 *  budget available again.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		static returnValue resetUnrolledStatements( );
+
+		/** Returns the largest number of statements that one function has
+		 *  unrolled (although loops would have been possible) since the
+		 *  budget has been set.
+		 */
+		static unsigned getMaxUnrolledStatements( );
+
 	//
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -170,6 +209,33 @@ class ExportArithmeticStatement : public ExportStatement
 										const std::string& _intString = "int"
 										) const;
 
+		/** Exports source code of one block of a blocked multiplication, i.e. of
+		 *  the product of _nRows rows of rhs1 (starting at row _ii) with _nCols
+		 *  columns of rhs2 (starting at column _jj). The partial sums are kept
+		 *  in scalar accumulators, such that the compiler can keep them in
+		 *  (vector) registers.
+		 *
+		 *	@param[in] stream			Name of file to be used to export statement.
+		 *	@param[in] transposeRhs1	Flag indicating whether rhs1 shall be transposed.
+		 *	@param[in] _ii				First row of the block.
+		 *	@param[in] _jj				First column of the block.
+		 *	@param[in] _kk				Index used for the inner product loop.
+		 *	@param[in] _nRows			Number of rows of the block.
+		 *	@param[in] _nCols			Number of columns of the block.
+		 *	@param[in] _realString		std::string to be used to declare real variables.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCodeMultiplyBlock(	std::ostream& stream,
+												bool transposeRhs1,
+												const ExportIndex& _ii,
+												const ExportIndex& _jj,
+												const ExportIndex& _kk,
+												uint _nRows,
+												uint _nCols,
+												const std::string& _realString = "real_t"
+												) const;
+
 		/** Exports source code for an assignment to given file. 
 		 *  Its appearance can be adjusted by various options.
 		 *
@@ -202,9 +268,26 @@ class ExportArithmeticStatement : public ExportStatement
 
 		MemoryAllocatorPtr memAllocator;
 
+		/** Flag indicating whether larger multiplications are exported as blocked kernels. */
+		static bool useBlockedMultiplication;
+
+		/** Maximum number of unrolled statements per function (0: no limit). */
+		static unsigned unrollingBudget;
+
+		/** Number of statements unrolled in the current function. */
+		static unsigned unrolledStatements;
+
+		/** Largest number of statements unrolled in one function. */
+		static unsigned maxUnrolledStatements;
+
     private:
 		std::string getAssignString( ) const;
 
+		/** Returns whether the given number of statements can still be unrolled
+		 *  in the current function, and takes them from the budget if so. */
+		static bool acquireUnrollingBudget(	unsigned _numStatements
+											);
+
 		uint getNumRows( ) const;
 		uint getNumCols( ) const;
 };
@@ -52,13 +52,22 @@ ExportAuxiliaryFunctions::ExportAuxiliaryFunctions(	const std::string& _headerFi
 {}
 
 
-returnValue ExportAuxiliaryFunctions::configure( )
+returnValue ExportAuxiliaryFunctions::configure(	bool _useContext
+												)
 {
+	string contextArgument = _useContext ? "ACADOcontext* acadoContext" : "";
+	// Context as the first of several arguments, in declarations and in calls
+	string contextArgumentComma = _useContext ? "ACADOcontext* acadoContext, " : "";
+	string contextComma = _useContext ? "acadoContext, " : "";
+
 	//
 	// Source file configuration
 	//
 
 	source.dictionary[ "@MODULE_NAME@" ] = moduleName;
+	source.dictionary[ "@CONTEXT_ARGUMENT@" ] = contextArgument;
+	source.dictionary[ "@CONTEXT_ARGUMENT_COMMA@" ] = contextArgumentComma;
+	source.dictionary[ "@CONTEXT_COMMA@" ] = contextComma;
 
 	source.fillTemplate();
 
@@ -66,6 +75,8 @@ returnValue ExportAuxiliaryFunctions::configure( )
 	// Header file configuration
 	//
 	header.dictionary[ "@MODULE_NAME@" ] = moduleName;
+	header.dictionary[ "@CONTEXT_ARGUMENT@" ] = contextArgument;
+	header.dictionary[ "@CONTEXT_ARGUMENT_COMMA@" ] = contextArgumentComma;
 
 	header.fillTemplate();
 
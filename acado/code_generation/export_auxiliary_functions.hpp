@@ -73,10 +73,13 @@ public:
 	{}
 
 	/** Configure the template
+	 *
+	 *	@param[in] _useContext		Flag indicating whether the functions take the context of reentrant code.
 	 *
 	 *  \return SUCCESSFUL_RETURN
 	 */
-	returnValue configure(	);
+	returnValue configure(	bool _useContext = false
+							);
 
 	/** Export the interface. */
 	returnValue exportCode();
@@ -54,7 +54,8 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
 											const std::map<std::string, std::pair<std::string, std::string> >& _options,
 											const std::string& _variables,
 											const std::string& _workspace,
-											const std::string& _functions
+											const std::string& _functions,
+											bool _useContext
 											)
 {
 	// Configure the template
@@ -65,6 +66,10 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
 	stringstream ss;
 	if( _useComplexArithmetic ) ss << "\n#include <complex.h>\n" << endl;
 
+	if ( _useContext )
+		ss	<< "/** The structure containing all data of one solver instance. */" << endl
+			<< "typedef struct ACADOcontext_ ACADOcontext;\n" << endl;
+
 	ss 	<< "/** qpOASES QP solver indicator. */" << endl
 		<< "#define ACADO_QPOASES 0" << endl
 		<< "/** FORCES QP solver indicator.*/" << endl
@@ -137,6 +142,44 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
 
 	dictionary[ "@FUNCTION_DECLARATIONS@" ] = _functions;
 
+	ss.str( string() );
+	if ( _useContext )
+	{
+		ss	<< "/*" << endl
+			<< " * Context of a solver instance." << endl
+			<< " */" << endl << endl
+			<< "/** The structure containing all data of one solver instance." << endl
+			<< " *" << endl
+			<< " *  All exported functions take a pointer to the context as their first" << endl
+			<< " *  argument, i.e. any number of instances can be used side by side, also" << endl
+			<< " *  from different threads. The structure does not contain any pointers," << endl
+			<< " *  so an instance can be cloned by assignment." << endl
+			<< " */" << endl
+			<< "struct ACADOcontext_" << endl
+			<< "{" << endl
+			<< "/** The user data, see ACADOvariables. */" << endl
+			<< "ACADOvariables variables;" << endl
+			<< "/** The private workspace, see ACADOworkspace. */" << endl
+			<< "ACADOworkspace workspace;" << endl;
+		if (_qpSolver == QP_QPOASES)
+			ss	<< "/** Number of working set recalculations in the last QP solution. */" << endl
+				<< "int nWSR;" << endl;
+		ss	<< "};" << endl << endl
+			<< "/* Within the exported functions, the data of the passed context are" << endl
+			<< " * referred to by the names of the global variables of non-reentrant code. */" << endl
+			<< "#define acadoVariables (acadoContext->variables)" << endl
+			<< "#define acadoWorkspace (acadoContext->workspace)" << endl;
+	}
+	else
+	{
+		ss	<< "/* " << endl
+			<< " * Extern declarations. " << endl
+			<< " */" << endl << endl
+			<< "extern ACADOworkspace acadoWorkspace;" << endl
+			<< "extern ACADOvariables acadoVariables;" << endl;
+	}
+	dictionary[ "@DATA_DECLARATIONS@" ] = ss.str();
+
 	// And then fill a template file
 	fillTemplate();
 
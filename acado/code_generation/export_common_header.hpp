@@ -69,7 +69,9 @@ public:
 	virtual ~ExportCommonHeader( )
 	{}
 
-	/** Configure the template
+	/** Configure the template. For reentrant code (_useContext), the data
+	 *  is declared as part of a context structure instead of as global
+	 *  variables.
 	 *
 	 *  \return SUCCESSFUL_RETURN
 	 */
@@ -80,7 +82,8 @@ public:
 							const std::map<std::string, std::pair<std::string, std::string> >& _options,
 							const std::string& _variables,
 							const std::string& _workspace,
-							const std::string& _functions
+							const std::string& _functions,
+							bool _useContext = false
 							);
 };
 
@@ -129,6 +129,9 @@ std::string ExportDataInternal::getTypeString(	const std::string& _realString,
 
 	case STATIC_CONST_REAL:
 		return std::string("static const ") + _realString;
+
+	case REAL_SINGLE:
+		return std::string("float");
 	}
 
 	return std::string("unknownType");
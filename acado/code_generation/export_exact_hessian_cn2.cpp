@@ -52,6 +52,11 @@ returnValue ExportExactHessianCN2::setup( )
 	if (performsSingleShooting() == true)
 		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
 
+	int hessianRegularization;
+	get( CG_HESSIAN_REGULARIZATION, hessianRegularization );
+	if ((HessianRegularizationMode)hessianRegularization == REGULARIZE_RICCATI && initialStateFixed() == false)
+		return ACADOERRORTEXT( RET_INVALID_OPTION, "The Riccati based Hessian regularization requires a fixed initial state." );
+
 	LOG( LVL_DEBUG ) << "Solver: setup initialization... " << endl;
 	setupInitialization();
 	LOG( LVL_DEBUG ) << "done!" << endl;
@@ -219,10 +224,8 @@ returnValue ExportExactHessianCN2::setupObjectiveEvaluation( void )
 
 returnValue ExportExactHessianCN2::setupHessianRegularization( )
 {
-	ExportVariable block( "hessian_block", NX+NU, NX+NU );
-	regularization = ExportFunction( "acado_regularize", block );
-	regularization.doc( "EVD-based regularization of a Hessian block." );
-	regularization.addLinebreak();
+	int hessianRegularization;
+	get( CG_HESSIAN_REGULARIZATION, hessianRegularization );
 
 	regularizeHessian.setup( "regularizeHessian" );
 	regularizeHessian.doc( "Regularization procedure of the computed exact Hessian." );
@@ -231,7 +234,32 @@ returnValue ExportExactHessianCN2::setupHessianRegularization( )
 	regularizeHessian.acquire( oInd );
 
 	ExportForLoop loopObjective(oInd, 0, N);
-	loopObjective.addFunctionCall( regularization, objS.getAddress(oInd*(NX+NU),0) );
+
+	if ( (HessianRegularizationMode)hessianRegularization == REGULARIZE_RICCATI )
+	{
+		ExportVariable blocks( "hessian_blocks", N*(NX+NU), NX+NU );
+		ExportVariable blockN( "hessian_end_term", NX, NX );
+		ExportVariable gx( "gx", N*NX, NX );
+		ExportVariable gu( "gu", N*NX, NU );
+		regularization = ExportFunction( "acado_regularize_riccati", blocks, blockN, gx, gu );
+		regularization.doc( "Regularization of the control Hessian blocks during a backward Riccati sweep." );
+		regularization.addLinebreak();
+
+		regularizeHessian.addFunctionCall( regularization, objS, objSEndTerm, evGx, evGu );
+	}
+	else
+	{
+		ExportVariable block( "hessian_block", NX+NU, NX+NU );
+		regularization = ExportFunction( "acado_regularize", block );
+		if ( (HessianRegularizationMode)hessianRegularization == REGULARIZE_MODIFIED_CHOLESKY )
+			regularization.doc( "Regularization of a Hessian block, based on a modified LDL' factorization." );
+		else
+			regularization.doc( "EVD-based regularization of a Hessian block." );
+		regularization.addLinebreak();
+
+		loopObjective.addFunctionCall( regularization, objS.getAddress(oInd*(NX+NU),0) );
+	}
+
 	loopObjective.addStatement( Q1.getRows(oInd*NX, oInd*NX+NX) == objS.getSubMatrix(oInd*(NX+NU), oInd*(NX+NU)+NX, 0, NX) );
 	loopObjective.addStatement( S1.getRows(oInd*NX, oInd*NX+NX) == objS.getSubMatrix(oInd*(NX+NU), oInd*(NX+NU)+NX, NX, NX+NU) );
 	loopObjective.addStatement( R1.getRows(oInd*NU, oInd*NU+NU) == objS.getSubMatrix(oInd*(NX+NU)+NX, oInd*(NX+NU)+NX+NU, NX, NX+NU) );
@@ -32,6 +32,10 @@
  */
 
 #include <acado/code_generation/export_file.hpp>
+#include <acado/code_generation/export_function.hpp>
+
+#include <algorithm>
+#include <sstream>
 
 using namespace std;
 
@@ -81,6 +85,53 @@ returnValue ExportFile::exportCode( ) const
 	return returnvalue;
 }
 
+returnValue ExportFile::exportCode(	std::vector< std::string >& _names,
+									std::vector< unsigned >& _bytes,
+									std::vector< unsigned >& _lines
+									) const
+{
+	_names.clear();
+	_bytes.clear();
+	_lines.clear();
+
+	ofstream stream( fileName.c_str() );
+
+	if (stream.good() == false)
+		return ACADOERROR( RET_DOES_DIRECTORY_EXISTS );
+
+	acadoPrintAutoGenerationNotice(stream, commentString);
+
+	if ( commonHeaderName.size() )
+		stream << "#include \"" << commonHeaderName << "\"\n\n\n";
+
+	//
+	// Export the statements one by one, to measure the code of the functions
+	//
+	StatementPtrArray::const_iterator it = statements.begin();
+	for(; it != statements.end(); ++it)
+	{
+		stringstream ss;
+
+		if ((*it)->exportCode(ss, realString, intString, precision) != SUCCESSFUL_RETURN)
+			return ACADOERROR( RET_UNABLE_TO_EXPORT_STATEMENT );
+
+		const std::string code = ss.str();
+		stream << code;
+
+		const ExportFunction* function = dynamic_cast< const ExportFunction* >( it->get() );
+		if (function != 0 && function->isDefined() == true)
+		{
+			_names.push_back( function->getName() );
+			_bytes.push_back( code.size() );
+			_lines.push_back( std::count(code.begin(), code.end(), '\n') );
+		}
+	}
+
+	stream.close();
+
+	return SUCCESSFUL_RETURN;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -85,6 +85,20 @@ class ExportFile : public ExportStatementBlock
 		 */
 		virtual returnValue exportCode( ) const;
 
+		/** Exports the file containing the auto-generated code, and returns
+		 *  the size of the code of each exported function.
+		 *
+		 *	@param[out] _names		Names of the exported functions.
+		 *	@param[out] _bytes		Size of the code of each function in bytes.
+		 *	@param[out] _lines		Number of lines of the code of each function.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCode(	std::vector< std::string >& _names,
+								std::vector< unsigned >& _bytes,
+								std::vector< unsigned >& _lines
+								) const;
+
     protected:
 
 		std::string fileName;					/**< Name of exported file. */
@@ -33,6 +33,7 @@
 
 #include <acado/code_generation/export_function.hpp>
 #include <acado/code_generation/export_function_call.hpp>
+#include <acado/code_generation/export_arithmetic_statement.hpp>
 
 using namespace std;
 
@@ -283,6 +284,9 @@ returnValue ExportFunction::exportCode(	std::ostream& stream,
 	for(; it != statements.end(); ++it)
 		(*it)->allocate( memAllocator );
 
+	// Each function has its own budget for unrolled statements
+	ExportArithmeticStatement::resetUnrolledStatements( );
+
 	//
 	// Open a temporary file and export statements to the temporary file
 	//
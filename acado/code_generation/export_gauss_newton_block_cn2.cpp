@@ -38,22 +38,35 @@ BEGIN_NAMESPACE_ACADO
 ExportGaussNewtonBlockCN2::ExportGaussNewtonBlockCN2(	UserInteraction* _userInteraction,
 											const std::string& _commonHeaderName
 											) : ExportGaussNewtonCN2( _userInteraction,_commonHeaderName )
-{}
+{
+	blockSize = 0;
+}
 
 returnValue ExportGaussNewtonBlockCN2::setup( )
 {
 	diagonalH = false;
 	diagonalHN = false;
 
+	int userBlockSize;
+	get(CONDENSING_BLOCK_SIZE, userBlockSize);
+
+	if (userBlockSize < 0 || userBlockSize > (int)N || (userBlockSize > 0 && N % userBlockSize != 0))
+		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "The condensing block size needs to be a divisor of the horizon length.");
+
+	if (userBlockSize > 0)
+		blockSize = userBlockSize;
+	else
+	{
+		blockSize = selectBlockSize();
+
+		LOG( LVL_INFO ) << "Automatically selected condensing block size: " << blockSize << endl;
+	}
+
 	LOG( LVL_DEBUG ) << "Condensing block size: " << getBlockSize() << endl;
 	LOG( LVL_DEBUG ) << "Number of blocks     : " << getNumberOfBlocks() << endl;
 	LOG( LVL_DEBUG ) << "# of variables each  : " << getNumBlockVariables() << endl;
 	LOG( LVL_DEBUG ) << "# of QP variables    : " << getNumQPvars() << " / " << N*(NX+NU)+NX << endl;
 
-	if (N/getBlockSize() != getNumberOfBlocks())
-		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "The condensing block size needs to be a divisor of the horizon length.");
-	if (getBlockSize() == 0 || getBlockSize() > N)
-		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "The condensing block size needs to be a divisor of the horizon length.");
 	if (getNumComplexConstraints() > 0)
 		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
 	if (performsSingleShooting() == true)
@@ -1088,12 +1101,64 @@ returnValue ExportGaussNewtonBlockCN2::setupMultiplicationRoutines( )
 
 uint ExportGaussNewtonBlockCN2::getBlockSize() const
 {
-	int blockSize;
-	get(CONDENSING_BLOCK_SIZE, blockSize);
-
 	return blockSize;
 }
 
+uint ExportGaussNewtonBlockCN2::selectBlockSize() const
+{
+	// Typical number of iterations of the structure exploiting QP solver
+	const double qpIterations = 10.0;
+
+	// Average number of bounded states per shooting node
+	double nb = 0.0;
+	for (unsigned i = 1; i < xBounds.getNumPoints(); ++i)
+	{
+		DVector lbBox = xBounds.getLowerBounds( i );
+		DVector ubBox = xBounds.getUpperBounds( i );
+
+		for (unsigned j = 0; j < lbBox.getDim(); ++j)
+			if (acadoIsFinite( lbBox( j ) ) == true || acadoIsFinite( ubBox( j ) ) == true)
+				nb += 1.0;
+	}
+	if (xBounds.getNumPoints() > 1)
+		nb /= (double)(xBounds.getNumPoints() - 1);
+
+	const double nx = NX;
+	const double nu = NU;
+
+	uint bestSize = N;
+	double bestCost = -1.0;
+
+	for (unsigned size = 1; size <= N; ++size)
+	{
+		if (N % size != 0)
+			continue;
+
+		const double m = size;
+		const double numBlocks = N / size;
+		const double nv = nx + m * nu;
+		const double nc = (m - 1.0) * nb;
+
+		// Forward sensitivities, Hessian and state bound blocks of all condensed blocks
+		double condensing = N * (m / 2.0) * nu * nx * (nx + nu + nb);
+
+		// Block factorization, elimination of the stage coupling and constraint terms
+		double qpSolution = numBlocks * (m * nu * m * nu * m * nu / 3.0 + nx * nv * nv + nx * nx * nx + nc * nv * nv);
+
+		double cost = condensing + qpIterations * qpSolution;
+
+		LOG( LVL_DEBUG ) << "Block size " << size << ": estimated cost " << cost << " flops" << endl;
+
+		if (bestCost < 0.0 || cost < bestCost)
+		{
+			bestCost = cost;
+			bestSize = size;
+		}
+	}
+
+	return bestSize;
+}
+
 uint ExportGaussNewtonBlockCN2::getNumberOfBlocks() const
 {
 	uint blockSize = getBlockSize();
@@ -109,6 +109,9 @@ public:
 	 */
 	unsigned getNumQPvars( ) const;
 
+	/** Returns the condensing block size. It is given by the option CONDENSING_BLOCK_SIZE,
+	 *  or selected by setup() from a cost model when the option is zero.
+	 */
 	uint getBlockSize( ) const;
 
 	uint getNumberOfBlocks( ) const;
@@ -149,8 +152,21 @@ protected:
 
 	virtual returnValue setupCondensing( );
 
+	/** Selects the block size that minimizes the estimated cost of one SQP iteration.
+	 *
+	 *  Only the divisors of the horizon length are considered. The estimate adds
+	 *  the flops of condensing each block to the flops of a structure exploiting
+	 *  QP solver on the resulting horizon, where every block is one stage with
+	 *  NX + blockSize * NU variables and the block state bounds as affine constraints.
+	 *
+	 *  \return Block size between 1 and N
+	 */
+	uint selectBlockSize( ) const;
+
 protected:
 
+	uint blockSize;
+
 	ExportIndex blockI;
 
 	std::vector< unsigned > qpConDim;
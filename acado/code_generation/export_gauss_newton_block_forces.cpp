@@ -358,10 +358,14 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportIndex index("index");
 	preparation.addIndex( index );
 
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( evaluateConstraints );
 
 	preparation.addLinebreak();
@@ -386,6 +390,8 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportVariable SlxCall =
 				objSlx.isGiven() == true || variableObjS == false ? objSlx : objSlx.getRows(N * NX, (N + 1) * NX);
 	preparation.addStatement( objGradients[ getNumberOfBlocks() ] += SlxCall );
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 	preparation.addLinebreak();
 
 	////////////////////////////////////////////////////////////////////////////
@@ -402,6 +408,7 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	feedback.setReturnValue( tmp );
 	feedback.addIndex( index );
 
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
 	if (initialStateFixed() == true)
 	{
 		feedback.addStatement( cond[ 0 ] == x0 - x.getRow( 0 ).getTranspose() );
@@ -439,19 +446,24 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportFunction solveQP;
 	solveQP.setup("solve");
 
+	addProfilingHook(feedback, PROFILE_QP, true);
 	feedback
 	<< tmp.getFullName() << " = "
 	<< qpModuleName << "_" << solveQP.getName() << "( "
 	<< "&" << qpObjPrefix << "_" << "params" << ", "
 	<< "&" << qpObjPrefix << "_" << "output" << ", "
 	<< "&" << qpObjPrefix << "_" << "info" << " );\n";
+	addProfilingHook(feedback, PROFILE_QP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	for (unsigned i = 0; i < getNumberOfBlocks(); ++i) {
 		feedback.addFunctionCall( expand, vecQPVars[i], ExportIndex(i) );
 	}
 
 	feedback.addStatement( x.getRow( N ) += vecQPVars[ getNumberOfBlocks() ].getTranspose() );
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 	feedback.addLinebreak();
 
 	////////////////////////////////////////////////////////////////////////////
@@ -95,10 +95,14 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	ExportIndex index("index");
 	preparation.addIndex( index );
 
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( evaluateConstraints );
 
 	preparation.addLinebreak();
@@ -128,6 +132,8 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	stringstream prep;
 	prep << retSim.getName() << " = prepareQpDunes( );" << endl;
 	preparation << prep.str();
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 	preparation.addLinebreak();
 
 	////////////////////////////////////////////////////////////////////////////
@@ -144,6 +150,7 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	feedback.setReturnValue( tmp );
 	feedback.addIndex( index );
 
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
 	if (initialStateFixed() == true)
 	{
 		feedback.addStatement( qpLb0.getTranspose().getRows(0, NX) == x0 - x.getRow( 0 ).getTranspose() );
@@ -156,15 +163,20 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	feedback.addLinebreak();
 
 	stringstream s;
+	addProfilingHook(feedback, PROFILE_QP, true);
 	s << tmp.getName() << " = solveQpDunes( );" << endl;
 	feedback <<  s.str();
+	addProfilingHook(feedback, PROFILE_QP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	ExportForLoop expandLoop( index, 0, getNumberOfBlocks() );
 	expandLoop.addFunctionCall( expand, index );
 	feedback.addStatement( expandLoop );
 
 	feedback.addStatement( (x.getRow(getNumberOfBlocks()*getBlockSize())).getTranspose() += xVars.getRows(getNumberOfBlocks()*getNumBlockVariables(), getNumberOfBlocks()*getNumBlockVariables()+NX) );
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
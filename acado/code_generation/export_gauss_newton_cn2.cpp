@@ -288,13 +288,8 @@ returnValue ExportGaussNewtonCN2::setupObjectiveEvaluation( void )
 
 	evaluateObjective.addIndex( runObj );
 
-	loopObjective.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runObj ) );
-	loopObjective.addLinebreak( );
-
 	// Evaluate the objective function
-	loopObjective.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+	setupStageCostEvaluation(evaluateObjective, loopObjective, runObj);
 
 	// Stack the measurement function value
 	loopObjective.addStatement(
@@ -656,10 +651,7 @@ returnValue ExportGaussNewtonCN2::setupConstraintsEvaluation( void )
 		condensePrep.acquire( runPac );
 		ExportForLoop loopPac(runPac, 0, N);
 
-		loopPac.addStatement( conValueIn.getCols(0, NX) == x.getRow( runPac ) );
-		loopPac.addStatement( conValueIn.getCols(NX, NX + NU) == u.getRow( runPac ) );
-		loopPac.addStatement( conValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runPac ) );
-		loopPac.addFunctionCall( evaluatePathConstraints.getName(), conValueIn, conValueOut );
+		setupPathConstraintsEvaluation(condensePrep, loopPac, runPac);
 
 		loopPac.addStatement( pacEvH.getRows( runPac * dimPacH, (runPac + 1) * dimPacH) ==
 				conValueOut.getTranspose().getRows(0, dimPacH) );
@@ -2015,11 +2007,17 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportArgumentList::getContextArgument() << ");\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( condensePrep );
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -2037,15 +2035,23 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( tmp );
 
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
+	addProfilingHook(feedback, PROFILE_QP_SETUP, true);
 	feedback.addFunctionCall( condenseFdb );
+	addProfilingHook(feedback, PROFILE_QP_SETUP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_QP, true);
 	stringstream s;
-	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	s << tmp.getName() << " = " << solve.getName() << "( " << ExportArgumentList::getContextArgument() << " );" << endl;
 	feedback <<  s.str();
+	addProfilingHook(feedback, PROFILE_QP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	feedback.addFunctionCall( expand );
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -2114,6 +2120,12 @@ returnValue ExportGaussNewtonCN2::setupQPInterface( )
 	int maxNumQPiterations;
 	get(MAX_NUM_QP_ITERATIONS, maxNumQPiterations);
 
+	int useReentrantCode;
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+
+	std::vector< int > shiftBounds, shiftConstraints;
+	getCondensedQPShift(performFullCondensing(), xBoundsIdx, shiftBounds, shiftConstraints);
+
 	//
 	// Set up export of the source file
 	//
@@ -2144,7 +2156,10 @@ returnValue ExportGaussNewtonCN2::setupQPInterface( )
 			lb.getFullName(),
 			ub.getFullName(),
 			lbA.getFullName(),
-			ubA.getFullName()
+			ubA.getFullName(),
+			useReentrantCode,
+			shiftBounds,
+			shiftConstraints
 	);
 
 	return qpInterface.exportCode();
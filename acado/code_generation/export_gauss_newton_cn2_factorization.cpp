@@ -316,13 +316,8 @@ returnValue ExportGaussNewtonCn2Factorization::setupObjectiveEvaluation( void )
 
 	evaluateObjective.addIndex( runObj );
 
-	loopObjective.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runObj ) );
-	loopObjective.addLinebreak( );
-
 	// Evaluate the objective function
-	loopObjective.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+	setupStageCostEvaluation(evaluateObjective, loopObjective, runObj);
 
 	// Stack the measurement function value
 	loopObjective.addStatement(
@@ -1783,10 +1778,16 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportArgumentList::getContextArgument() << ");\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( condensePrep );
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -1804,15 +1805,23 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( tmp );
 
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
+	addProfilingHook(feedback, PROFILE_QP_SETUP, true);
 	feedback.addFunctionCall( condenseFdb );
+	addProfilingHook(feedback, PROFILE_QP_SETUP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_QP, true);
 	stringstream s;
-	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	s << tmp.getName() << " = " << solve.getName() << "( " << ExportArgumentList::getContextArgument() << " );" << endl;
 	feedback <<  s.str();
+	addProfilingHook(feedback, PROFILE_QP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	feedback.addFunctionCall( expand );
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -1884,6 +1893,12 @@ returnValue ExportGaussNewtonCn2Factorization::setupQPInterface( )
 	int externalCholesky;
 	get(CG_CONDENSED_HESSIAN_CHOLESKY, externalCholesky);
 
+	int useReentrantCode;
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+
+	std::vector< int > shiftBounds, shiftConstraints;
+	getCondensedQPShift(performFullCondensing(), xBoundsIdx, shiftBounds, shiftConstraints);
+
 	//
 	// Set up export of the source file
 	//
@@ -1914,7 +1929,10 @@ returnValue ExportGaussNewtonCn2Factorization::setupQPInterface( )
 			lb.getFullName(),
 			ub.getFullName(),
 			lbA.getFullName(),
-			ubA.getFullName()
+			ubA.getFullName(),
+			useReentrantCode,
+			shiftBounds,
+			shiftConstraints
 	);
 
 	return qpInterface.exportCode();
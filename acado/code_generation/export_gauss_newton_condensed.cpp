@@ -297,13 +297,8 @@ returnValue ExportGaussNewtonCondensed::setupObjectiveEvaluation( void )
 
 	evaluateObjective.addIndex( runObj );
 
-	loopObjective.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runObj ) );
-	loopObjective.addLinebreak( );
-
 	// Evaluate the objective function
-	loopObjective.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+	setupStageCostEvaluation(evaluateObjective, loopObjective, runObj);
 
 	// Stack the measurement function value
 	loopObjective.addStatement(
@@ -748,10 +743,7 @@ returnValue ExportGaussNewtonCondensed::setupConstraintsEvaluation( void )
 		condensePrep.acquire( runPac );
 		ExportForLoop loopPac(runPac, 0, N);
 
-		loopPac.addStatement( conValueIn.getCols(0, NX) == x.getRow( runPac ) );
-		loopPac.addStatement( conValueIn.getCols(NX, NX + NU) == u.getRow( runPac ) );
-		loopPac.addStatement( conValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runPac ) );
-		loopPac.addFunctionCall( evaluatePathConstraints.getName(), conValueIn, conValueOut );
+		setupPathConstraintsEvaluation(condensePrep, loopPac, runPac);
 
 		loopPac.addStatement( pacEvH.getRows( runPac * dimPacH, (runPac + 1) * dimPacH) ==
 				conValueOut.getTranspose().getRows(0, dimPacH) );
@@ -2249,10 +2241,16 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportArgumentList::getContextArgument() << ");\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( condensePrep );
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -2270,18 +2268,26 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( tmp );
 
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
+	addProfilingHook(feedback, PROFILE_QP_SETUP, true);
 	feedback.addFunctionCall( condenseFdb );
+	addProfilingHook(feedback, PROFILE_QP_SETUP, false);
 	feedback.addLinebreak();
 
-	feedback << tmp.getName() << " = " << solve.getName() << "( );\n";
+	addProfilingHook(feedback, PROFILE_QP, true);
+	feedback << tmp.getName() << " = " << solve.getName() << "( " << ExportArgumentList::getContextArgument() << " );\n";
+	addProfilingHook(feedback, PROFILE_QP, false);
 	feedback.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	feedback.addFunctionCall( expand );
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
 
 	int covCalc;
 	get(CG_COMPUTE_COVARIANCE_MATRIX, covCalc);
 	if (covCalc)
 		feedback.addFunctionCall( calculateCovariance );
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -2353,6 +2359,12 @@ returnValue ExportGaussNewtonCondensed::setupQPInterface( )
 	int externalCholesky;
 	get(CG_CONDENSED_HESSIAN_CHOLESKY, externalCholesky);
 
+	int useReentrantCode;
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+
+	std::vector< int > shiftBounds, shiftConstraints;
+	getCondensedQPShift(performFullCondensing(), xBoundsIdx, shiftBounds, shiftConstraints);
+
 	//
 	// Set up export of the source file
 	//
@@ -2382,7 +2394,10 @@ returnValue ExportGaussNewtonCondensed::setupQPInterface( )
 			lb.getFullName(),
 			ub.getFullName(),
 			lbA.getFullName(),
-			ubA.getFullName()
+			ubA.getFullName(),
+			useReentrantCode,
+			shiftBounds,
+			shiftConstraints
 	);
 
 	return qpInterface.exportCode();
@@ -257,13 +257,8 @@ returnValue ExportGaussNewtonForces::setupObjectiveEvaluation( void )
 
 	evaluateObjective.addIndex( runObj );
 
-	loopObjective.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runObj ) );
-	loopObjective.addLinebreak( );
-
 	// Evaluate the objective function
-	loopObjective.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+	setupStageCostEvaluation(evaluateObjective, loopObjective, runObj);
 
 	// Stack the measurement function value
 	loopObjective.addStatement(
@@ -924,10 +919,16 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( evaluateConstraints );
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -941,6 +942,8 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( returnValueFeedbackPhase );
 
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
+	addProfilingHook(feedback, PROFILE_QP_SETUP, true);
 	feedback.addStatement(
 			//			cond[ 0 ].getRows(0, NX) == x0 - x.getRow( 0 ).getTranspose()
 			cond[ 0 ] == x0 - x.getRow( 0 ).getTranspose()
@@ -954,6 +957,7 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	for (unsigned i = 0; i < N; ++i)
 		feedback.addFunctionCall(setStagef, objGradients[ i ], ExportIndex( i ));
 	feedback.addStatement( objGradients[ N ] == QN2 * DyN );
+	addProfilingHook(feedback, PROFILE_QP_SETUP, false);
 	feedback.addLinebreak();
 
 	//
@@ -1016,12 +1020,14 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	ExportFunction solveQP;
 	solveQP.setup("solve");
 
+	addProfilingHook(feedback, PROFILE_QP, true);
 	feedback
 	<< returnValueFeedbackPhase.getFullName() << " = "
 	<< qpModuleName << "_" << solveQP.getName() << "( "
 	<< "&" << qpObjPrefix << "_" << "params" << ", "
 	<< "&" << qpObjPrefix << "_" << "output" << ", "
 	<< "&" << qpObjPrefix << "_" << "info" << " );\n";
+	addProfilingHook(feedback, PROFILE_QP, false);
 	feedback.addLinebreak();
 
 	//
@@ -1037,11 +1043,14 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	acc.addStatement( u.getRow( index ) += stageOut.getCols(NX, NX + NU) );
 	acc.addLinebreak();
 
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	for (unsigned i = 0; i < N; ++i)
 		feedback.addFunctionCall(acc, vecQPVars[ i ], ExportIndex( i ));
 	feedback.addLinebreak();
 
 	feedback.addStatement( x.getRow( N ) += vecQPVars[ N ].getTranspose() );
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 	feedback.addLinebreak();
 
 	////////////////////////////////////////////////////////////////////////////
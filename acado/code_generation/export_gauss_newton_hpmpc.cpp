@@ -235,13 +235,8 @@ returnValue ExportGaussNewtonHpmpc::setupObjectiveEvaluation( void )
 
 	evaluateObjective.addIndex( runObj );
 
-	loopObjective.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( runObj ) );
-	loopObjective.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( runObj ) );
-	loopObjective.addLinebreak( );
-
 	// Evaluate the objective function
-	loopObjective.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+	setupStageCostEvaluation(evaluateObjective, loopObjective, runObj);
 
 	// Stack the measurement function value
 	loopObjective.addStatement(
@@ -594,10 +589,16 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addProfilingHook(preparation, PROFILE_PREPARATION, true);
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
 
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, true);
 	preparation.addFunctionCall( evaluateObjective );
+	addProfilingHook(preparation, PROFILE_OBJECTIVE, false);
+	addProfilingHook(preparation, PROFILE_CONDENSING, true);
 	preparation.addFunctionCall( evaluateConstraints );
+	addProfilingHook(preparation, PROFILE_CONDENSING, false);
+	addProfilingHook(preparation, PROFILE_PREPARATION, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -630,7 +631,12 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 		// Temporary hack for the workspace
 		feedback << "static real_t qpWork[ HPMPC_RIC_MHE_IF_DP_WORK_SPACE ];\n";
 	}
-	else
+
+	// After the declaration of the workspace
+	addProfilingHook(feedback, PROFILE_FEEDBACK, true);
+	addProfilingHook(feedback, PROFILE_QP_SETUP, true);
+
+	if (initialStateFixed() == true)
 	{
 		// State feedback
 		feedback.addStatement( qpx.getRows(0, NX) == x0 - x.getRow( 0 ).getTranspose() );
@@ -658,12 +664,14 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 		// It is assumed this is the shifted version from the previous time step!
 		feedback.addStatement( DxAC == xAC - x.getRow( 0 ).getTranspose() );
 	}
+	addProfilingHook(feedback, PROFILE_QP_SETUP, false);
 
 	//
 	// Here we have to add the differences....
 	//
 
 	// Call the solver
+	addProfilingHook(feedback, PROFILE_QP, true);
 	if (initialStateFixed() == true)
 		feedback
 			<< returnValueFeedbackPhase.getFullName() << " = " << "acado_hpmpc_ip_wrapper("
@@ -739,9 +747,12 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 	double *lam, double *work0 );
 	*/
 
+	addProfilingHook(feedback, PROFILE_QP, false);
+
 	// XXX Not 100% sure about this one
 
 	// Accumulate the solution, i.e. perform full Newton step
+	addProfilingHook(feedback, PROFILE_EXPANSION, true);
 	feedback.addStatement( x.makeColVector() += qpx );
 	feedback.addStatement( u.makeColVector() += qpu );
 
@@ -750,6 +761,8 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 		// This is the arrival cost for the next time step!
 		feedback.addStatement( xAC == x.getRow( 1 ).getTranspose() + DxAC );
 	}
+	addProfilingHook(feedback, PROFILE_EXPANSION, false);
+	addProfilingHook(feedback, PROFILE_FEEDBACK, false);
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -39,13 +39,14 @@ BEGIN_NAMESPACE_ACADO
 
 ExportHessianRegularization::ExportHessianRegularization(	const std::string& _sourceFileName,
 													const std::string& _moduleName,
+													HessianRegularizationMode _mode,
 													const std::string& _commonHeaderName,
 													const std::string& _realString,
 													const std::string& _intString,
 													int _precision,
 													const std::string& _commentString
 													)
-	: ExportTemplatedFile(HESSIAN_REG_SOURCE, _sourceFileName, _commonHeaderName, _realString, _intString, _precision, _commentString)
+	: ExportTemplatedFile(_mode == REGULARIZE_MIRROR_EVD ? HESSIAN_REG_SOURCE : HESSIAN_REG_LDL_SOURCE, _sourceFileName, _commonHeaderName, _realString, _intString, _precision, _commentString)
 {
 	moduleName = _moduleName;
 }
@@ -37,7 +37,8 @@
 BEGIN_NAMESPACE_ACADO
 
 /**
- *	\brief A class for generating code implementing a symmetric EigenValue Decomposition.
+ *	\brief A class for generating code implementing the regularization of Hessian blocks,
+ *	based on a symmetric EigenValue Decomposition or on a modified LDL' factorization.
  *
  *	\ingroup ExportHessianRegularization
  *
@@ -50,6 +51,7 @@ public:
 	/** Default constructor.
 	 *
 	 *	@param[in] _moduleName		    Module name for customization.
+	 *	@param[in] _mode				Regularization method, selects the template.
 	 *	@param[in] _commonHeaderName	Name of common header file to be included.
 	 *	@param[in] _realString			std::string to be used to declare real variables.
 	 *	@param[in] _intString			std::string to be used to declare integer variables.
@@ -60,6 +62,7 @@ public:
 	 */
 	ExportHessianRegularization(	const std::string& _sourceFileName,
 								const std::string& _moduleName = "acado",
+								HessianRegularizationMode _mode = REGULARIZE_MIRROR_EVD,
 								const std::string& _commonHeaderName = "",
 								const std::string& _realString = "double",
 								const std::string& _intString = "int",
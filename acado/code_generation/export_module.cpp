@@ -93,6 +93,14 @@ returnValue ExportModule::setupOptions( )
 	addOption( CG_COMPUTE_COVARIANCE_MATRIX,     NO         );
 	addOption( CG_USE_OPENMP,					 NO         );
 	addOption( CG_HARDCODE_CONSTRAINT_VALUES,    YES        );
+	addOption( CG_USE_BATCHED_EVALUATION,        NO         );
+	addOption( CG_USE_REENTRANT_CODE,            NO         );
+	addOption( CG_USE_BLOCKED_LINEAR_ALGEBRA,    YES        );
+	addOption( CG_UNROLLING_BUDGET,              0          );
+	addOption( CG_CODE_SIZE_BUDGET,              0          );
+	addOption( CG_HESSIAN_REGULARIZATION,        REGULARIZE_MIRROR_EVD );
+	addOption( CG_USE_PROFILING,                 NO         );
+	addOption( CG_USE_MIXED_PRECISION,           NO         );
 	addOption( CG_USE_ARRIVAL_COST,              NO         );
 
 	addOption( CG_CONDENSED_HESSIAN_CHOLESKY,    EXTERNAL   );
@@ -34,6 +34,8 @@
 #include <acado/objective/objective.hpp>
 #include <acado/ocp/ocp.hpp>
 
+#include <algorithm>
+
 BEGIN_NAMESPACE_ACADO
 
 using namespace std;
@@ -113,6 +115,8 @@ returnValue ExportNLPSolver::getDataDeclarations(	ExportStatementBlock& declarat
 	declarations.addDeclaration(objAuxVar, dataStruct);
 	declarations.addDeclaration(objValueIn, dataStruct);
 	declarations.addDeclaration(objValueOut, dataStruct);
+	declarations.addDeclaration(objValueInBatch, dataStruct);
+	declarations.addDeclaration(objValueOutBatch, dataStruct);
 
 	declarations.addDeclaration(Q1, dataStruct);
 	declarations.addDeclaration(Q2, dataStruct);
@@ -132,6 +136,8 @@ returnValue ExportNLPSolver::getDataDeclarations(	ExportStatementBlock& declarat
 	declarations.addDeclaration(conAuxVar, dataStruct);
 	declarations.addDeclaration(conValueIn, dataStruct);
 	declarations.addDeclaration(conValueOut, dataStruct);
+	declarations.addDeclaration(conValueInBatch, dataStruct);
+	declarations.addDeclaration(conValueOutBatch, dataStruct);
 
 	declarations.addDeclaration(pacEvH, dataStruct);
 	declarations.addDeclaration(pacEvHx, dataStruct);
@@ -157,6 +163,12 @@ returnValue ExportNLPSolver::getDataDeclarations(	ExportStatementBlock& declarat
 	declarations.addDeclaration(acXTilde, dataStruct);
 	declarations.addDeclaration(acHTilde, dataStruct);
 
+	// Profiling
+	declarations.addDeclaration(profileTime, dataStruct);
+	declarations.addDeclaration(profileCount, dataStruct);
+	declarations.addDeclaration(profileStats, dataStruct);
+	declarations.addDeclaration(profileSamples, dataStruct);
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -199,6 +211,8 @@ returnValue ExportNLPSolver::setupSimulation( void )
 	int sensitivityProp;
 	get( DYNAMIC_SENSITIVITY, sensitivityProp );
 
+	setupProfiling();
+
 	modelSimulation.setup( "modelSimulation" );
 	ExportVariable retSim("ret", 1, 1, INT, ACADO_LOCAL, true);
 	modelSimulation.setReturnValue(retSim, false);
@@ -293,21 +307,25 @@ returnValue ExportNLPSolver::setupSimulation( void )
 
 	// Integrate the model
 	// TODO make that function calls can accept constant defined scalars
+	// The workspace of the profiling is not shared among the OpenMP threads
+	if (useOMP == 0)
+		addProfilingHook(loop, PROFILE_INTEGRATION, true);
+
 	int intMode;
 	get( IMPLICIT_INTEGRATOR_MODE, intMode );
 	if ( integrator->equidistantControlGrid() )
 	{
 		if( (ImplicitIntegratorMode)intMode == LIFTED ) {
 			loop	<< retSim.getFullName() << " = "
-					<< "integrate" << "(" << state.getFullName()
+					<< "integrate" << "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName()
 					<< ", " << run.getFullName() << ");\n";
 		}
 		else if (performsSingleShooting() == false)
 			loop 	<< retSim.getFullName() << " = "
-				 	<< "integrate" << "(" << state.getFullName() << ", 1);\n";
+				 	<< "integrate" << "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", 1);\n";
 		else
 			loop 	<< retSim.getFullName() << " = " << "integrate"
-					<< "(" << state.getFullName() << ", "
+					<< "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", "
 					<< run.getFullName() << " == 0"
 					<< ");\n";
 	}
@@ -316,14 +334,16 @@ returnValue ExportNLPSolver::setupSimulation( void )
 		if (performsSingleShooting() == false)
 			loop 	<< retSim.getFullName() << " = "
 					<< "integrate"
-					<< "(" << state.getFullName() << ", 1, " << run.getFullName() << ");\n";
+					<< "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", 1, " << run.getFullName() << ");\n";
 		else
 			loop	<< retSim.getFullName() << " = "
 					<< "integrate"
-					<< "(" << state.getFullName() << ", "
+					<< "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", "
 					<< run.getFullName() << " == 0"
 					<< ", " << run.getFullName() << ");\n";
 	}
+	if (useOMP == 0)
+		addProfilingHook(loop, PROFILE_INTEGRATION, false);
 	loop.addLinebreak( );
 	if (useOMP == 0)
 	{
@@ -885,6 +905,8 @@ returnValue ExportNLPSolver::setLSQObjective(const Objective& _objective)
 	objValueIn.setup("objValueIn", 1, NX + 0 + NU + NOD, REAL, ACADO_WORKSPACE);
 	objValueOut.setup("objValueOut", 1, objF.getDim(), REAL, ACADO_WORKSPACE);
 
+	setupBatchedEvaluation(evaluateStageCost, objValueInBatch, objValueOutBatch, "objValue", objF.getDim());
+
 	//
 	// Optional pre-computing of Q1, Q2, R1, R2 matrices
 	//
@@ -1321,6 +1343,8 @@ returnValue ExportNLPSolver::setConstraints(const OCP& _ocp)
 
 		evaluatePathConstraints.init(pacH, "evaluatePathConstraints", NX, 0, NU, NP, 0, NOD);
 		evaluatePathConstraints.setGlobalExportVariable( conAuxVar );
+
+		setupBatchedEvaluation(evaluatePathConstraints, conValueInBatch, conValueOutBatch, "conValue", pacH.getDim());
 	}
 
 	////////////////////////////////////////////////////////////////////////////
@@ -1472,6 +1496,44 @@ unsigned ExportNLPSolver::getNumComplexConstraints( void )
 	return N * dimPacH + dimPocH;
 }
 
+returnValue ExportNLPSolver::getCondensedQPShift(	bool _fullCondensing,
+													const std::vector< unsigned >& _xBoundsIdx,
+													std::vector< int >& _shiftBounds,
+													std::vector< int >& _shiftConstraints
+													)
+{
+	// Bounds: the initial state (if it is a QP variable) stays, the controls move one interval ahead
+	unsigned offset = _fullCondensing == true ? 0 : NX;
+
+	_shiftBounds.resize(offset + N * NU);
+	for (unsigned i = 0; i < offset; ++i)
+		_shiftBounds[ i ] = i;
+	for (unsigned i = 0; i < N; ++i)
+		for (unsigned j = 0; j < NU; ++j)
+			_shiftBounds[offset + i * NU + j] = i < N - 1 ? offset + (i + 1) * NU + j : offset + i * NU + j;
+
+	// Constraints: state bounds, then path constraints node by node, then point constraints
+	unsigned numStateBounds = _xBoundsIdx.size();
+
+	_shiftConstraints.resize(numStateBounds + getNumComplexConstraints());
+	for (unsigned i = 0; i < _shiftConstraints.size(); ++i)
+		_shiftConstraints[ i ] = i;
+
+	for (unsigned i = 0; i < numStateBounds; ++i)
+		for (unsigned k = 0; k < numStateBounds; ++k)
+			if (_xBoundsIdx[ k ] == _xBoundsIdx[ i ] + NX)
+			{
+				_shiftConstraints[ i ] = k;
+				break;
+			}
+
+	for (unsigned i = 0; i < N - 1; ++i)
+		for (unsigned j = 0; j < dimPacH; ++j)
+			_shiftConstraints[numStateBounds + i * dimPacH + j] = numStateBounds + (i + 1) * dimPacH + j;
+
+	return SUCCESSFUL_RETURN;
+}
+
 bool ExportNLPSolver::initialStateFixed() const
 {
 	int fixInitialState;
@@ -1488,6 +1550,96 @@ bool ExportNLPSolver::usingLinearTerms() const
 	return false;
 }
 
+bool ExportNLPSolver::usingProfiling() const
+{
+	int useProfiling;
+	get(CG_USE_PROFILING, useProfiling);
+
+	return (bool)useProfiling;
+}
+
+returnValue ExportNLPSolver::getProfilingDeclarations(	ExportStatementBlock& declarations
+														) const
+{
+	if (usingProfiling() == false)
+		return SUCCESSFUL_RETURN;
+
+	// The hooks are defined with the auxiliary functions
+	declarations
+		<< "\n/** Profiling hook, starts the timing of a phase of the RTI steps. */\n"
+		<< "void profileStart( " << ExportArgumentList::getContextArgument(true, ", ") << "int phase );\n"
+		<< "\n/** Profiling hook, stops the timing of a phase of the RTI steps and records its execution time. */\n"
+		<< "void profileStop( " << ExportArgumentList::getContextArgument(true, ", ") << "int phase );\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+std::string ExportNLPSolver::getProfilingPhaseName(	ExportProfilingPhase _phase
+													)
+{
+	switch ( _phase )
+	{
+	case PROFILE_PREPARATION:
+		return "preparation";
+	case PROFILE_INTEGRATION:
+		return "integration";
+	case PROFILE_OBJECTIVE:
+		return "objective";
+	case PROFILE_CONDENSING:
+		return "condensing";
+	case PROFILE_FEEDBACK:
+		return "feedback";
+	case PROFILE_QP_SETUP:
+		return "qp_setup";
+	case PROFILE_QP:
+		return "qp";
+	case PROFILE_EXPANSION:
+		return "expansion";
+	default:
+		return "";
+	}
+}
+
+unsigned ExportNLPSolver::getProfilingNumSamples( )
+{
+	return 256;
+}
+
+returnValue ExportNLPSolver::setupProfiling()
+{
+	if (usingProfiling() == false)
+		return SUCCESSFUL_RETURN;
+
+	//
+	// Start time (seconds and nanoseconds of a monotonic clock), number of
+	// executions, minimum, maximum and sum of the execution times, and the
+	// most recent execution times of all phases
+	//
+	profileTime.setup("profileTime", PROFILE_NUM_PHASES, 2, INT, ACADO_WORKSPACE);
+	profileCount.setup("profileCount", PROFILE_NUM_PHASES, 1, INT, ACADO_WORKSPACE);
+	profileStats.setup("profileStats", PROFILE_NUM_PHASES, 3, REAL, ACADO_WORKSPACE);
+	profileSamples.setup("profileSamples", PROFILE_NUM_PHASES, getProfilingNumSamples(), REAL, ACADO_WORKSPACE);
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ExportNLPSolver::addProfilingHook(	ExportStatementBlock& _block,
+												ExportProfilingPhase _phase,
+												bool _start
+												) const
+{
+	if (usingProfiling() == false)
+		return SUCCESSFUL_RETURN;
+
+	string name = getProfilingPhaseName( _phase );
+	transform(name.begin(), name.end(), name.begin(), ::toupper);
+
+	_block	<< (_start == true ? "profileStart" : "profileStop")
+			<< "( " << ExportArgumentList::getContextArgument(false, ", ") << "ACADO_PROFILE_" << name << " );\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
 returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 {
 	////////////////////////////////////////////////////////////////////////////
@@ -1511,6 +1663,20 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 	shiftControls.addStatement(u.getRow(N - 1) == uEnd.getTranspose());
 	shiftControls.addStatement( "}\n" );
 
+	int qpSolver, qpSolution, hotstartQP, useReentrantCode;
+	get(QP_SOLVER, qpSolver);
+	get(SPARSE_QP_SOLUTION, qpSolution);
+	get(HOTSTART_QP, hotstartQP);
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+
+	// The qpOASES interface keeps the last working set in this case, shift it as well
+	if ((QPSolverName)qpSolver == QP_QPOASES && (SparseQPsolutionMethods)qpSolution != SPARSE_RICCATI &&
+			(bool)hotstartQP == true && (bool)useReentrantCode == false)
+	{
+		shiftControls.addLinebreak( );
+		shiftControls.addStatement( "shiftWorkingSet( );\n" );
+	}
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// Shift states
@@ -1580,11 +1746,11 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 
 	if ( integrator->equidistantControlGrid() )
 	{
-		shiftStates << "integrate" << "(" << state.getFullName() << ", 1);\n";
+		shiftStates << "integrate" << "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", 1);\n";
 	}
 	else
 	{
-		shiftStates << "integrate" << "(" << state.getFullName() << ", 1, " << toString(N - 1) << ");\n";
+		shiftStates << "integrate" << "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", 1, " << toString(N - 1) << ");\n";
 	}
 
 	shiftStates.addLinebreak( );
@@ -1624,14 +1790,14 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 	if ( integrator->equidistantControlGrid() )
 	{
 		iLoop << "integrate"
-				<< "(" << state.getFullName() << ", "
+				<< "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", "
 				<< index.getFullName() << " == 0"
 				<< ");\n";
 	}
 	else
 	{
 		iLoop << "integrate"
-				<< "(" << state.getFullName() << ", "
+				<< "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", "
 				<< index.getFullName() << " == 0"
 				<< ", " << index.getFullName() << ");\n";
 	}
@@ -1686,13 +1852,8 @@ returnValue ExportNLPSolver::setupGetLSQObjective() {
 
 	ExportForLoop loopObjective(oInd, 0, N);
 
-	loopObjective.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( oInd ) );
-	loopObjective.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( oInd ) );
-	loopObjective.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( oInd ) );
-	loopObjective.addLinebreak( );
-
 	// Evaluate the objective function
-	loopObjective.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+	setupStageCostEvaluation(getObjective, loopObjective, oInd);
 
 	// Stack the measurement function value
 	loopObjective.addStatement(
@@ -1809,6 +1970,91 @@ unsigned ExportNLPSolver::weightingMatricesType( void ) const
 	return 1;
 }
 
+returnValue ExportNLPSolver::setupBatchedEvaluation(	ExportAcadoFunction& fcn,
+														ExportVariable& valueInBatch,
+														ExportVariable& valueOutBatch,
+														const std::string& name,
+														unsigned dimOut
+														)
+{
+	int useBatchedEvaluation;
+	get(CG_USE_BATCHED_EVALUATION, useBatchedEvaluation);
+
+	if ((bool)useBatchedEvaluation == false || N == 0)
+		return fcn.setNumberOfPoints( 0 );
+
+	// Inputs and outputs of all nodes are stored point-wise contiguous, i.e.
+	// as columns of the batch variables
+	valueInBatch.setup(name + "InBatch", NX + NU + NOD, N, REAL, ACADO_WORKSPACE);
+	valueOutBatch.setup(name + "OutBatch", dimOut, N, REAL, ACADO_WORKSPACE);
+
+	return fcn.setNumberOfPoints( N );
+}
+
+returnValue ExportNLPSolver::setupStageCostEvaluation(	ExportStatementBlock& block,
+														ExportForLoop& loop,
+														const ExportIndex& index
+														)
+{
+	if (evaluateStageCost.getNumberOfPoints() == 0)
+	{
+		loop.addStatement( objValueIn.getCols(0, getNX()) == x.getRow( index ) );
+		loop.addStatement( objValueIn.getCols(NX, NX + NU) == u.getRow( index ) );
+		loop.addStatement( objValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( index ) );
+		loop.addLinebreak( );
+
+		loop.addFunctionCall(evaluateStageCost, objValueIn, objValueOut);
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	ExportForLoop loopBatch(index, 0, N);
+
+	loopBatch.addStatement( objValueInBatch.getSubMatrix(0, NX, index, index + 1) == x.getRow( index ).getTranspose() );
+	loopBatch.addStatement( objValueInBatch.getSubMatrix(NX, NX + NU, index, index + 1) == u.getRow( index ).getTranspose() );
+	if (NOD > 0)
+		loopBatch.addStatement( objValueInBatch.getSubMatrix(NX + NU, NX + NU + NOD, index, index + 1) == od.getRow( index ).getTranspose() );
+
+	block.addStatement( loopBatch );
+	block.addFunctionCall(evaluateStageCost.getBatchName(), objValueInBatch, objValueOutBatch);
+	block.addLinebreak( );
+
+	loop.addStatement( objValueOut == objValueOutBatch.getCols(index, index + 1).getTranspose() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ExportNLPSolver::setupPathConstraintsEvaluation(	ExportStatementBlock& block,
+																ExportForLoop& loop,
+																const ExportIndex& index
+																)
+{
+	if (evaluatePathConstraints.getNumberOfPoints() == 0)
+	{
+		loop.addStatement( conValueIn.getCols(0, NX) == x.getRow( index ) );
+		loop.addStatement( conValueIn.getCols(NX, NX + NU) == u.getRow( index ) );
+		loop.addStatement( conValueIn.getCols(NX + NU, NX + NU + NOD) == od.getRow( index ) );
+		loop.addFunctionCall( evaluatePathConstraints.getName(), conValueIn, conValueOut );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	ExportForLoop loopBatch(index, 0, N);
+
+	loopBatch.addStatement( conValueInBatch.getSubMatrix(0, NX, index, index + 1) == x.getRow( index ).getTranspose() );
+	loopBatch.addStatement( conValueInBatch.getSubMatrix(NX, NX + NU, index, index + 1) == u.getRow( index ).getTranspose() );
+	if (NOD > 0)
+		loopBatch.addStatement( conValueInBatch.getSubMatrix(NX + NU, NX + NU + NOD, index, index + 1) == od.getRow( index ).getTranspose() );
+
+	block.addStatement( loopBatch );
+	block.addFunctionCall( evaluatePathConstraints.getBatchName(), conValueInBatch, conValueOutBatch );
+	block.addLinebreak( );
+
+	loop.addStatement( conValueOut == conValueOutBatch.getCols(index, index + 1).getTranspose() );
+
+	return SUCCESSFUL_RETURN;
+}
+
 returnValue ExportNLPSolver::setupArrivalCostCalculation()
 {
 	int useArrivalCost;
@@ -1887,9 +2133,9 @@ returnValue ExportNLPSolver::setupArrivalCostCalculation()
 	updateArrivalCost.addStatement( state.getCols(indexU, indexNOD) == od.getRow( 0 ) );
 
 	if (integrator->equidistantControlGrid())
-		updateArrivalCost << "integrate" << "(" << state.getFullName() << ", 1);\n";
+		updateArrivalCost << "integrate" << "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", 1);\n";
 	else
-		updateArrivalCost << "integrate" << "(" << state.getFullName() << ", 1, " << toString(0) << ");\n";
+		updateArrivalCost << "integrate" << "(" << ExportArgumentList::getContextArgument(false, ", ") << state.getFullName() << ", 1, " << toString(0) << ");\n";
 	updateArrivalCost.addLinebreak( );
 
 	//
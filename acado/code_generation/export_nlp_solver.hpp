@@ -46,6 +46,20 @@ BEGIN_NAMESPACE_ACADO
 class OCP;
 class Objective;
 
+/** Phases of the RTI steps which are timed by the profiling hooks of an exported solver. */
+enum ExportProfilingPhase
+{
+	PROFILE_PREPARATION,	/**< The whole preparation step. */
+	PROFILE_INTEGRATION,	/**< The integration of one shooting interval, including the sensitivities. */
+	PROFILE_OBJECTIVE,		/**< The evaluation of the objective, including the regularization of an exact Hessian. */
+	PROFILE_CONDENSING,		/**< The condensing (or other setup of the QP) in the preparation step. */
+	PROFILE_FEEDBACK,		/**< The whole feedback step. */
+	PROFILE_QP_SETUP,		/**< The setup of the QP data which depend on the current state and references. */
+	PROFILE_QP,				/**< The solution of the QP. */
+	PROFILE_EXPANSION,		/**< The expansion of the QP solution and the update of the iterate. */
+	PROFILE_NUM_PHASES
+};
+
 /** 
  *	\brief Base class for export of NLP/OCP solvers.
  *
@@ -178,6 +192,30 @@ public:
 	/** Indicates whether linear terms in the objective are used. */
 	bool usingLinearTerms() const;
 
+	/** Indicates whether the phases of the RTI steps are profiled. */
+	bool usingProfiling() const;
+
+	/** Adds the declarations of the profiling hooks, which are exported with
+	 *  the auxiliary functions, to given list of declarations.
+	 *
+	 *	@param[in] declarations		List of declarations.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue getProfilingDeclarations(	ExportStatementBlock& declarations
+											) const;
+
+	/** Returns the name of a profiled phase. The phase is indexed by the macro
+	 *  ACADO_PROFILE_<NAME> in the exported code.
+	 */
+	static std::string getProfilingPhaseName(	ExportProfilingPhase _phase
+												);
+
+	/** Returns the number of most recent execution times of each phase from
+	 *  which the exported code computes the percentiles.
+	 */
+	static unsigned getProfilingNumSamples( );
+
 protected:
 
 	/** Setting up of a model simulation:
@@ -209,6 +247,19 @@ protected:
 	/** Setup of functions for evaluation of auxiliary functions. */
 	returnValue setupAuxiliaryFunctions();
 
+	/** Computes how the working set of a condensed QP moves when the horizon is
+	 *  shifted by one interval: for each bound and constraint, the index of the
+	 *  bound or constraint whose status it takes over. Bounds and constraints
+	 *  on the last interval keep their own status.
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue getCondensedQPShift(	bool _fullCondensing,
+										const std::vector< unsigned >& _xBoundsIdx,
+										std::vector< int >& _shiftBounds,
+										std::vector< int >& _shiftConstraints
+										);
+
 	/** Setup the function for evaluating the actual objective value. */
 	virtual returnValue setupGetObjective();
 
@@ -224,6 +275,46 @@ protected:
 	/** Setup main initialization code for the solver */
 	virtual returnValue setupInitialization();
 
+	/** Setup of the workspace for profiling of the RTI steps. */
+	returnValue setupProfiling();
+
+	/** Adds a call of the profiling hook which starts (or stops) the timing of
+	 *  a phase to the block. Nothing is added if profiling is not enabled.
+	 */
+	returnValue addProfilingHook(	ExportStatementBlock& _block,
+									ExportProfilingPhase _phase,
+									bool _start
+									) const;
+
+	/** Adds the evaluation of the stage cost at the node index to the loop
+	 *  over the shooting nodes; the result is stored in objValueOut. With
+	 *  batched evaluation, the stage cost is evaluated on all nodes at once
+	 *  in the block, i.e. before the loop is added to the block.
+	 */
+	returnValue setupStageCostEvaluation(	ExportStatementBlock& block,
+											ExportForLoop& loop,
+											const ExportIndex& index
+											);
+
+	/** Adds the evaluation of the path constraints at the node index to the
+	 *  loop over the shooting nodes, see setupStageCostEvaluation(); the result
+	 *  is stored in conValueOut.
+	 */
+	returnValue setupPathConstraintsEvaluation(	ExportStatementBlock& block,
+												ExportForLoop& loop,
+												const ExportIndex& index
+												);
+
+	/** Sets up the batched variant of a function which is evaluated on the
+	 *  first N shooting nodes, if batched evaluation is enabled.
+	 */
+	returnValue setupBatchedEvaluation(	ExportAcadoFunction& fcn,
+										ExportVariable& valueInBatch,
+										ExportVariable& valueOutBatch,
+										const std::string& name,
+										unsigned dimOut
+										);
+
 protected:
 
 	/** \name Evaluation of model dynamics. */
@@ -262,6 +353,7 @@ protected:
 	ExportVariable objEvFxx, objEvFxu, objEvFuu, objEvFxxEnd; // aliasing
 
 	ExportVariable objAuxVar, objValueIn, objValueOut;
+	ExportVariable objValueInBatch, objValueOutBatch;
 	ExportAcadoFunction evaluateStageCost;
 	ExportAcadoFunction evaluateTerminalCost;
 
@@ -289,6 +381,7 @@ protected:
 	ExportVariable conAuxVar;
 	ExportVariable conValueIn;
 	ExportVariable conValueOut;
+	ExportVariable conValueInBatch, conValueOutBatch;
 
 	DVector lbPathConValues, ubPathConValues;
 
@@ -340,6 +433,11 @@ protected:
 	ExportFunction regularization;
 	/** @} */
 
+	/** \name Profiling of the RTI steps */
+	/**  @{ */
+	ExportVariable profileTime, profileCount, profileStats, profileSamples;
+	/** @} */
+
 private:
 	returnValue setupResidualVariables();
 	returnValue setupObjectiveLinearTerms(const Objective& _objective);
@@ -356,6 +454,7 @@ enum ExportNLPType
 	GAUSS_NEWTON_FORCES,
 	GAUSS_NEWTON_QPDUNES,
 	GAUSS_NEWTON_HPMPC,
+	GAUSS_NEWTON_RICCATI,
 	EXACT_HESSIAN_CN2,
 	EXACT_HESSIAN_QPDUNES
 };
@@ -72,15 +72,24 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 												const std::string& _qplb,
 												const std::string& _qpub,
 												const std::string& _qplbA,
-												const std::string& _qpubA
+												const std::string& _qpubA,
+												bool _useContext,
+												const std::vector< int >& _shiftBounds,
+												const std::vector< int >& _shiftConstraints
 												)
 {
 	//
 	// Source file configuration
 	//
 
-	stringstream s, ctor;
+	stringstream s, sWorkingSet, ctor;
 	string solverName;
+
+	// Reentrant code keeps the number of working set recalculations in the context
+	string nWSR = _useContext ? "acadoContext->nWSR" : _prefix + "nWSR";
+	string nWSRDeclaration = _useContext ? "" : "static int " + nWSR + ";";
+	// The header is also included by the qpOASES sources, which do not know the context typedef
+	string contextArgument = _useContext ? "struct ACADOcontext_* acadoContext" : "void";
 	if (ncmax > 0)
 	{
 		solverName = "QProblem";
@@ -89,11 +98,15 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 		if (_externalCholesky == false)
 			s << _qpR << ", ";
 		s	<< _qpg << ", " << _qpA << ", " << _qplb << ", " << _qpub << ", "
-			<< _qplbA << ", " << _qpubA << ", " << "nWSR";
+			<< _qplbA << ", " << _qpubA << ", " << nWSR;
 
 		if ( (bool)_hotstartQP == true )
 			s << ", " << _dualSolution;
 
+		sWorkingSet	<< _qpH << ", " << (_externalCholesky == false ? _qpR : "0") << ", "
+					<< _qpg << ", " << _qpA << ", " << _qplb << ", " << _qpub << ", "
+					<< _qplbA << ", " << _qpubA << ", " << nWSR << ", &guessedBounds, &guessedConstraints";
+
 		ctor << solverName << " qp(" << nvmax << ", " << ncmax << ")";
 	}
 	else
@@ -103,23 +116,51 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 		s	<< _qpH << ", ";
 		if (_externalCholesky == false)
 			s << _qpR << ", ";
-		s	<< _qpg << ", " << _qplb << ", " << _qpub << ", " << "nWSR";
+		s	<< _qpg << ", " << _qplb << ", " << _qpub << ", " << nWSR;
 
 		if ( (bool)_hotstartQP == true )
 			s << ", " << _dualSolution;
 
+		sWorkingSet	<< _qpH << ", " << (_externalCholesky == false ? _qpR : "0") << ", "
+					<< _qpg << ", " << _qplb << ", " << _qpub << ", " << nWSR << ", &guessedBounds";
+
 		ctor << solverName << " qp( " << nvmax << " )";
 	}
 
+	// The persistent solver cannot be kept in the context of reentrant code
+	bool hotstartWorkingSet = _hotstartQP == true && _useContext == false;
+
+	stringstream shift;
+	if (hotstartWorkingSet == true)
+	{
+		shift << "static const int shiftBounds[ " << nvmax << " ] = {";
+		for (int i = 0; i < nvmax; ++i)
+			shift << (i > 0 ? ", " : " ") << ((unsigned)i < _shiftBounds.size() ? _shiftBounds[ i ] : i);
+		shift << " };";
+
+		if (ncmax > 0)
+		{
+			shift << endl << "static const int shiftConstraints[ " << ncmax << " ] = {";
+			for (int i = 0; i < ncmax; ++i)
+				shift << (i > 0 ? ", " : " ") << ((unsigned)i < _shiftConstraints.size() ? _shiftConstraints[ i ] : i);
+			shift << " };";
+		}
+	}
+
 	qpoSource.dictionary[ "@ACADO_COMMON_HEADER@" ] =  _commonHeader;
 	qpoSource.dictionary[ "@SOLVER_NAME@" ] =  solverName;
 	qpoSource.dictionary[ "@PREFIX@" ] =  _prefix;
 	qpoSource.dictionary[ "@USE_NAMESPACE@" ] =  _namespace;
 	qpoSource.dictionary[ "@CALL_SOLVER@" ] =  s.str();
+	qpoSource.dictionary[ "@CALL_SOLVER_WORKING_SET@" ] =  sWorkingSet.str();
+	qpoSource.dictionary[ "@SHIFT_DECLARATION@" ] =  shift.str();
 	qpoSource.dictionary[ "@PRIMAL_SOLUTION@" ] =  _primalSolution;
 	qpoSource.dictionary[ "@DUAL_SOLUTION@" ] =  _dualSolution;
 	qpoSource.dictionary[ "@CTOR@" ] =  ctor.str();
 	qpoSource.dictionary[ "@SIGMA@" ] =  _sigma;
+	qpoSource.dictionary[ "@NWSR@" ] =  nWSR;
+	qpoSource.dictionary[ "@NWSR_DECLARATION@" ] =  nWSRDeclaration;
+	qpoSource.dictionary[ "@CONTEXT_ARGUMENT@" ] =  contextArgument;
 
 	// And then fill a template file
 	qpoSource.fillTemplate();
@@ -131,6 +172,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 	// Configure the dictionary
 	qpoHeader.dictionary[ "@PREFIX@" ] =  _prefix;
 	qpoHeader.dictionary[ "@SOLVER_DEFINE@" ] =  _solverDefine;
+	qpoHeader.dictionary[ "@CONTEXT_ARGUMENT@" ] =  contextArgument;
 
 	qpoHeader.dictionary[ "@NVMAX@" ] = toString( nvmax );
 
@@ -140,6 +182,8 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 
 	qpoHeader.dictionary[ "@PRINT_LEVEL@" ] =  _printLevel;
 
+	qpoHeader.dictionary[ "@HOTSTART@" ] =  toString( hotstartWorkingSet == true ? 1 : 0 );
+
 	double eps;
 	string realT;
 	if ( _useSinglePrecision )
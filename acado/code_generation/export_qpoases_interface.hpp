@@ -75,6 +75,12 @@ public:
 	{}
 
 	/** Configure the template
+	 *
+	 *	With QP hot-starting (and without reentrant code), the solver is kept
+	 *	between the calls and started from the last working set. The optional
+	 *	shift maps give, for each bound and constraint, the index of the bound
+	 *	or constraint whose status it takes over when the horizon is shifted;
+	 *	by default the working set is not changed by a shift.
 	 *
 	 *  \return SUCCESSFUL_RETURN
 	 */
@@ -100,7 +106,10 @@ public:
 							const std::string& _qplb,
 							const std::string& _qpub,
 							const std::string& _qplbA,
-							const std::string& _qpubA
+							const std::string& _qpubA,
+							bool _useContext = false,
+							const std::vector< int >& _shiftBounds = std::vector< int >(),
+							const std::vector< int >& _shiftConstraints = std::vector< int >()
 							);
 
 	/** Export the interface. */
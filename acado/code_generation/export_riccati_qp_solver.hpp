@@ -0,0 +1,91 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file include/acado/code_generation/export_riccati_qp_solver.hpp
+ *    \author Milan Vukov
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_EXPORT_RICCATI_QP_SOLVER_HPP
+#define ACADO_TOOLKIT_EXPORT_RICCATI_QP_SOLVER_HPP
+
+
+#include <acado/code_generation/export_templated_file.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+/**
+ *	\brief Generator of a self-contained interior point QP solver based on the Riccati recursion
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *	The exported solver handles the sparse QP of the RTI scheme with box
+ *	constraints on states and controls. Its Newton steps cost O(N (NX + NU)^3)
+ *	flops and it does not depend on any external library.
+ *
+ *	\author Milan Vukov
+ */
+class ExportRiccatiQpSolver : public ExportTemplatedFile
+{
+public:
+	/** Default constructor.
+	 *
+	 *	@param[in] _fileName			Name of exported file.
+	 *	@param[in] _commonHeaderName	Name of common header file to be included.
+	 *	@param[in] _realString			std::string to be used to declare real variables.
+	 *	@param[in] _intString			std::string to be used to declare integer variables.
+	 *	@param[in] _precision			Number of digits to be used for exporting real values.
+	 *	@param[in] _commentString		std::string to be used for exporting comments.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	ExportRiccatiQpSolver(	const std::string& _fileName,
+							const std::string& _commonHeaderName = "",
+							const std::string& _realString = "real_t",
+							const std::string& _intString = "int",
+							int _precision = 16,
+							const std::string& _commentString = std::string()
+							);
+
+	/** Destructor. */
+	virtual ~ExportRiccatiQpSolver( )
+	{}
+
+	/** Configure the template
+	 *
+	 *	@param[in] _maxIter		Maximum number of interior point iterations.
+	 *	@param[in] _printLevel	Print level, 0 means silent.
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue configure(	const unsigned _maxIter,
+							const unsigned _printLevel
+							);
+};
+
+CLOSE_NAMESPACE_ACADO
+
+#endif // ACADO_TOOLKIT_EXPORT_RICCATI_QP_SOLVER_HPP
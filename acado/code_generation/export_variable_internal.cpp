@@ -145,7 +145,7 @@ const std::string ExportVariableInternal::get(	const ExportIndex& rowIdx,
 		}
 		else
 		{
-			s << "(real_t)" << data->operator()(totalIdx.getGivenValue());
+			s << (getType() == REAL_SINGLE ? "(float)" : "(real_t)") << data->operator()(totalIdx.getGivenValue());
 		}
 	}
 	else
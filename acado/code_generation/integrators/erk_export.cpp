@@ -53,6 +53,9 @@ ExplicitRungeKuttaExport::ExplicitRungeKuttaExport(	const ExplicitRungeKuttaExpo
 									) : RungeKuttaExport( arg )
 {
 	copy( arg );
+
+	rk_xxx_nom = arg.rk_xxx_nom;
+	rk_kkk_nom = arg.rk_kkk_nom;
 }
 
 
@@ -70,6 +73,15 @@ returnValue ExplicitRungeKuttaExport::setup( )
 
 	bool DERIVATIVES = ((ExportSensitivityType)sensGen != NO_SENSITIVITY);
 
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+
+	// the sensitivities are propagated in single precision, the nominal states in double precision
+	int mixedPrecision;
+	get( CG_USE_MIXED_PRECISION,mixedPrecision );
+	bool MIXED = ((bool)mixedPrecision == true && DERIVATIVES);
+	if( MIXED && useOMP ) return ACADOERRORTEXT( RET_INVALID_OPTION, "The mixed precision mode is not supported in combination with OpenMP." );
+
 	LOG( LVL_DEBUG ) << "Preparing to export ExplicitRungeKuttaExport... " << endl;
 
 	// export RK scheme
@@ -83,12 +95,11 @@ returnValue ExplicitRungeKuttaExport::setup( )
 
 	ExportVariable Ah ( "A*h",  DMatrix( AA )*=h );
 	ExportVariable b4h( "b4*h", DMatrix( bb )*=h );
+	ExportVariable Ah_single( "A*h", DMatrix( AA )*=h, REAL_SINGLE );
 
 	rk_index = ExportVariable( "rk_index", 1, 1, INT, ACADO_LOCAL, true );
 	rk_eta = ExportVariable( "rk_eta", 1, inputDim );
 
-	int useOMP;
-	get(CG_USE_OPENMP, useOMP);
 	ExportStruct structWspace;
 	structWspace = useOMP ? ACADO_LOCAL : ACADO_WORKSPACE;
 
@@ -96,8 +107,16 @@ returnValue ExplicitRungeKuttaExport::setup( )
 	uint timeDep = 0;
 	if( timeDependant ) timeDep = 1;
 	
-	rk_xxx.setup("rk_xxx", 1, inputDim+timeDep, REAL, structWspace);
-	rk_kkk.setup("rk_kkk", rkOrder, rhsDim, REAL, structWspace);
+	rk_xxx.setup("rk_xxx", 1, inputDim+timeDep, MIXED ? REAL_SINGLE : REAL, structWspace);
+	rk_kkk.setup("rk_kkk", rkOrder, rhsDim, MIXED ? REAL_SINGLE : REAL, structWspace);
+	if( MIXED ) {
+		rk_xxx_nom.setup("rk_xxx_nom", 1, NX+NU+NOD+timeDep, REAL, structWspace);
+		rk_kkk_nom.setup("rk_kkk_nom", rkOrder, NX, REAL, structWspace);
+	}
+	else {
+		rk_xxx_nom = ExportVariable();
+		rk_kkk_nom = ExportVariable();
+	}
 
 	if ( useOMP )
 	{
@@ -150,6 +169,7 @@ returnValue ExplicitRungeKuttaExport::setup( )
 
 	if( inputDim > rhsDim ) {
 		integrate.addStatement( rk_xxx.getCols( rhsDim,inputDim ) == rk_eta.getCols( rhsDim,inputDim ) );
+		if( MIXED ) integrate.addStatement( rk_xxx_nom.getCols( NX,NX+NU+NOD ) == rk_eta.getCols( rhsDim,inputDim ) );
 	}
 	integrate.addLinebreak( );
 
@@ -165,11 +185,28 @@ returnValue ExplicitRungeKuttaExport::setup( )
 
 	for( uint run1 = 0; run1 < rkOrder; run1++ )
 	{
-		loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + Ah.getRow(run1)*rk_kkk );
-		if( timeDependant ) loop.addStatement( rk_xxx.getCol( inputDim ) == rk_ttt + ((double)cc(run1))/grid.getNumIntervals() );
+		if( MIXED ) {
+			// the nominal trajectory is integrated in double precision and refines the states of the sensitivity system
+			loop.addStatement( rk_xxx_nom.getCols( 0,NX ) == rk_eta.getCols( 0,NX ) + Ah.getRow(run1)*rk_kkk_nom );
+			loop.addStatement( rk_xxx.getCols( 0,NX ) == rk_xxx_nom.getCols( 0,NX ) );
+			loop.addStatement( rk_xxx.getCols( NX,rhsDim ) == rk_eta.getCols( NX,rhsDim ) + Ah_single.getRow(run1)*rk_kkk.getCols( NX,rhsDim ) );
+			if( timeDependant ) loop.addStatement( rk_xxx_nom.getCol( NX+NU+NOD ) == rk_ttt + ((double)cc(run1))/grid.getNumIntervals() );
+			if( timeDependant ) loop.addStatement( rk_xxx.getCol( inputDim ) == rk_xxx_nom.getCol( NX+NU+NOD ) );
+			loop.addFunctionCall( getNameRHS(),rk_xxx_nom,rk_kkk_nom.getAddress(run1,0) );
+		}
+		else {
+			loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + Ah.getRow(run1)*rk_kkk );
+			if( timeDependant ) loop.addStatement( rk_xxx.getCol( inputDim ) == rk_ttt + ((double)cc(run1))/grid.getNumIntervals() );
+		}
 		loop.addFunctionCall( getNameDiffsRHS(),rk_xxx,rk_kkk.getAddress(run1,0) );
 	}
-	loop.addStatement( rk_eta.getCols( 0,rhsDim ) += b4h^rk_kkk );
+	if( MIXED ) {
+		loop.addStatement( rk_eta.getCols( 0,NX ) += b4h^rk_kkk_nom );
+		loop.addStatement( rk_eta.getCols( NX,rhsDim ) += b4h^rk_kkk.getCols( NX,rhsDim ) );
+	}
+	else {
+		loop.addStatement( rk_eta.getCols( 0,rhsDim ) += b4h^rk_kkk );
+	}
 	loop.addStatement( rk_ttt += DMatrix(1.0/grid.getNumIntervals()) );
     // end of integrator loop
 
@@ -259,6 +296,13 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 				& diffs_rhs.init(f, "acado_rhs_ext", NX * (1 + NX + NU), 0, NU, NP, NDX, NOD);
 	}
 	else if( (ExportSensitivityType)sensGen == FORWARD ) {
+		int mixedPrecision;
+		get( CG_USE_MIXED_PRECISION,mixedPrecision );
+		if( (bool)mixedPrecision == true ) {
+			return rhs.init(f_ODE, "acado_rhs", NX, 0, NU, NP, NDX, NOD)
+					& diffs_rhs.init(f, "acado_rhs_forw", NX * (1 + NX + NU), 0, NU, NP, NDX, NOD)
+					& diffs_rhs.setSinglePrecision( true );
+		}
 		return diffs_rhs.init(f, "acado_rhs_forw", NX * (1 + NX + NU), 0, NU, NP, NDX, NOD);
 	}
 	else {
@@ -291,12 +335,18 @@ returnValue ExplicitRungeKuttaExport::getDataDeclarations(	ExportStatementBlock&
 													ExportStruct dataStruct
 													) const
 {
-	if( exportRhs ) {
+	if( exportRhs && diffs_rhs.isSinglePrecision() ) {
+		declarations.addDeclaration( rhs.getGlobalExportVariable(),dataStruct );
+		declarations.addDeclaration( diffs_rhs.getGlobalExportVariable(),dataStruct );
+	}
+	else if( exportRhs ) {
 		declarations.addDeclaration( getAuxVariable(),dataStruct );
 	}
 	declarations.addDeclaration( rk_ttt,dataStruct );
 	declarations.addDeclaration( rk_xxx,dataStruct );
 	declarations.addDeclaration( rk_kkk,dataStruct );
+	declarations.addDeclaration( rk_xxx_nom,dataStruct );
+	declarations.addDeclaration( rk_kkk_nom,dataStruct );
 
 //	declarations.addDeclaration( reset_int,dataStruct );
 
@@ -211,6 +211,9 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 
     protected:
 
+		ExportVariable	rk_xxx_nom;			/**< Variable containing the nominal states in mixed precision mode. */
+		ExportVariable	rk_kkk_nom;			/**< Variable containing the nominal stage values in mixed precision mode. */
+
 
 };
 
@@ -0,0 +1,502 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/code_generation/integrators/irk_adjoint_export.cpp
+ *    \author Rien Quirynen
+ *    \date 2014
+ */
+
+#include <acado/code_generation/integrators/irk_export.hpp>
+#include <acado/code_generation/integrators/irk_adjoint_export.hpp>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+AdjointIRKExport::AdjointIRKExport(	UserInteraction* _userInteraction,
+									const std::string& _commonHeaderName
+									) : ImplicitRungeKuttaExport( _userInteraction,_commonHeaderName )
+{
+	SECOND_ORDER = false;
+}
+
+AdjointIRKExport::AdjointIRKExport( const AdjointIRKExport& arg ) : ImplicitRungeKuttaExport( arg )
+{
+	SECOND_ORDER = arg.SECOND_ORDER;
+	diffs_sweep = arg.diffs_sweep;
+
+	rk_A_traj = arg.rk_A_traj;
+	rk_aux_traj = arg.rk_aux_traj;
+	rk_diffs_traj = arg.rk_diffs_traj;
+	rk_S_traj = arg.rk_S_traj;
+	rk_xxx_traj = arg.rk_xxx_traj;
+	rk_seed = arg.rk_seed;
+	rk_hess = arg.rk_hess;
+}
+
+
+AdjointIRKExport::~AdjointIRKExport( )
+{
+	if ( solver )
+		delete solver;
+	solver = 0;
+
+	clear( );
+}
+
+
+AdjointIRKExport& AdjointIRKExport::operator=( const AdjointIRKExport& arg ){
+
+    if( this != &arg ){
+
+		ImplicitRungeKuttaExport::operator=( arg );
+
+		SECOND_ORDER = arg.SECOND_ORDER;
+		diffs_sweep = arg.diffs_sweep;
+
+		rk_A_traj = arg.rk_A_traj;
+		rk_aux_traj = arg.rk_aux_traj;
+		rk_diffs_traj = arg.rk_diffs_traj;
+		rk_S_traj = arg.rk_S_traj;
+		rk_xxx_traj = arg.rk_xxx_traj;
+		rk_seed = arg.rk_seed;
+		rk_hess = arg.rk_hess;
+    }
+    return *this;
+}
+
+
+returnValue AdjointIRKExport::setDifferentialEquation(	const Expression& rhs_ )
+{
+	int sensGen;
+	get( DYNAMIC_SENSITIVITY, sensGen );
+	SECOND_ORDER = ( (ExportSensitivityType)sensGen == THREE_SWEEPS );
+
+	returnValue returnvalue = ImplicitRungeKuttaExport::setDifferentialEquation( rhs_ );
+	if( returnvalue != SUCCESSFUL_RETURN || !SECOND_ORDER || rhs_.getDim() == 0 ) return returnvalue;
+
+	if( NXA > 0 || NDX2 > 0 ) return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+	// second order derivatives of the adjoint weighted right-hand side, projected on the forward sensitivities:
+	DifferentialState lx("", NX,1);
+	DifferentialState Gx("", NX,NX), Gu("", NX,NU);
+
+	Expression S = Gx;
+	S.appendCols(Gu);
+	Expression arg;
+	arg << x;
+	arg << u;
+
+	Expression S_tmp = S;
+	S_tmp.appendRows(zeros<double>(NU,NX).appendCols(eye<double>(NU)));
+
+	Expression h_tmp = symmetricDerivative( rhs_, arg, S_tmp, lx );
+
+	DifferentialEquation h;
+	for( uint i = 0; i < NX+NU; i++ ) {
+		for( uint j = 0; j <= i; j++ ) {
+			h << h_tmp(i,j);
+		}
+	}
+
+	return diffs_sweep.init( h,"acado_diffs_sweep",2*NX+NX*(NX+NU),0,NU,NP,NDX,NOD );
+}
+
+
+ExportVariable AdjointIRKExport::getAuxVariable() const
+{
+	ExportVariable max;
+	max = rhs.getGlobalExportVariable();
+	if( diffs_rhs.getGlobalExportVariable().getDim() >= max.getDim() ) {
+		max = diffs_rhs.getGlobalExportVariable();
+	}
+	if( SECOND_ORDER && diffs_sweep.getGlobalExportVariable().getDim() >= max.getDim() ) {
+		max = diffs_sweep.getGlobalExportVariable();
+	}
+	return max;
+}
+
+
+returnValue AdjointIRKExport::getDataDeclarations(	ExportStatementBlock& declarations,
+													ExportStruct dataStruct
+													) const
+{
+	ImplicitRungeKuttaExport::getDataDeclarations( declarations, dataStruct );
+
+	declarations.addDeclaration( rk_A_traj,dataStruct );
+	declarations.addDeclaration( rk_aux_traj,dataStruct );
+	declarations.addDeclaration( rk_diffs_traj,dataStruct );
+
+	if( SECOND_ORDER ) {
+		declarations.addDeclaration( rk_xxx_traj,dataStruct );
+		declarations.addDeclaration( rk_S_traj,dataStruct );
+		declarations.addDeclaration( rk_seed,dataStruct );
+		declarations.addDeclaration( rk_hess,dataStruct );
+	}
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue AdjointIRKExport::getCode(	ExportStatementBlock& code )
+{
+	int sensGen;
+	get( DYNAMIC_SENSITIVITY, sensGen );
+	if ( (ExportSensitivityType)sensGen != BACKWARD && (ExportSensitivityType)sensGen != THREE_SWEEPS ) return ACADOERROR( RET_INVALID_OPTION );
+
+	// NOT SUPPORTED: since the forward sweep needs to be saved
+	if( !equidistantControlGrid() ) return ACADOERROR( RET_INVALID_OPTION );
+
+	// NOT SUPPORTED: the backward sweep reuses the LU factorization of the Newton matrix
+	int solverType;
+	get( LINEAR_ALGEBRA_SOLVER, solverType );
+	if( (LinearAlgebraSolver)solverType != GAUSS_LU ) return ACADOERROR( RET_INVALID_OPTION );
+
+	if( !exportRhs || NX1 > 0 || NX3 > 0 || NXA > 0 || NDX2 > 0 || CONTINUOUS_OUTPUT || timeDependant ) {
+		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+	}
+
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	if ( useOMP ) {
+		ExportVariable max = getAuxVariable();
+		max.setName( "auxVar" );
+		max.setDataStruct( ACADO_LOCAL );
+		rhs.setGlobalExportVariable( max );
+		diffs_rhs.setGlobalExportVariable( max );
+		if( SECOND_ORDER ) diffs_sweep.setGlobalExportVariable( max );
+
+		getDataDeclarations( code, ACADO_LOCAL );
+
+		stringstream s;
+		s << "#pragma omp threadprivate( "
+				<< max.getFullName() << ", "
+				<< rk_ttt.getFullName() << ", "
+				<< rk_xxx.getFullName() << ", "
+				<< rk_kkk.getFullName() << ", "
+				<< rk_rhsTemp.getFullName() << ", "
+				<< rk_auxSolver.getFullName() << ", "
+				<< rk_A.getFullName() << ", "
+				<< rk_b.getFullName() << ", "
+				<< rk_diffsTemp2.getFullName() << ", "
+				<< rk_A_traj.getFullName() << ", "
+				<< rk_aux_traj.getFullName() << ", "
+				<< rk_diffs_traj.getFullName();
+		solver->appendVariableNames( s );
+		if( SECOND_ORDER ) {
+			s << ", " << rk_xxx_traj.getFullName();
+			s << ", " << rk_S_traj.getFullName();
+			s << ", " << rk_seed.getFullName();
+			s << ", " << rk_hess.getFullName();
+		}
+		s << " )" << endl << endl;
+		code.addStatement( s.str().c_str() );
+	}
+
+	code.addFunction( rhs );
+	code.addStatement( "\n\n" );
+	code.addFunction( diffs_rhs );
+	code.addStatement( "\n\n" );
+	if( SECOND_ORDER ) {
+		code.addFunction( diffs_sweep );
+		code.addStatement( "\n\n" );
+	}
+	solver->getCode( code );
+	code.addLinebreak(2);
+
+	// export RK scheme
+	uint run5;
+
+	initializeDDMatrix();
+	initializeCoefficients();
+
+	double h = (grid.getLastTime() - grid.getFirstTime())/grid.getNumIntervals();
+	DMatrix tmp = AA;
+	ExportVariable Ah( "Ah_mat", tmp*=h, STATIC_CONST_REAL );
+	code.addDeclaration( Ah );
+	code.addLinebreak( 2 );
+	// TODO: Ask Milan why this does NOT work properly !!
+	Ah = ExportVariable( "Ah_mat", numStages, numStages, STATIC_CONST_REAL, ACADO_LOCAL );
+
+	DVector BB( bb );
+	ExportVariable Bh( "Bh_mat", DMatrix( BB*=h ) );
+
+	ExportVariable C;
+
+	code.addComment(std::string("Fixed step size:") + toString(h));
+
+	ExportVariable determinant( "det", 1, 1, REAL, ACADO_LOCAL, true );
+	integrate.addDeclaration( determinant );
+
+	ExportIndex i( "i" );
+	ExportIndex j( "j" );
+	ExportIndex k( "k" );
+	ExportIndex run( "run" );
+	ExportIndex run1( "run1" );
+	ExportIndex tmp_index1("tmp_index1");
+	ExportIndex tmp_index2("tmp_index2");
+
+	integrate.addIndex( i );
+	integrate.addIndex( j );
+	integrate.addIndex( k );
+	integrate.addIndex( run );
+	integrate.addIndex( run1 );
+	integrate.addIndex( tmp_index1 );
+	integrate.addIndex( tmp_index2 );
+
+	integrate.addStatement( rk_ttt == DMatrix(grid.getFirstTime()) );
+	if( NU+NOD > 0 ) {
+		integrate.addStatement( rk_xxx.getCols( NX,NX+NU+NOD ) == rk_eta.getCols( NX+diffsDim,inputDim ) );
+	}
+
+	// initialize sensitivities:
+	if( SECOND_ORDER ) {
+		DMatrix idX    = eye<double>( NX );
+		DMatrix zeroXU = zeros<double>( NX,NU );
+		integrate.addStatement( rk_eta.getCols( 2*NX,NX*(2+NX) ) == idX.makeVector().transpose() );
+		if( NU > 0 ) integrate.addStatement( rk_eta.getCols( NX*(2+NX),NX*(2+NX+NU) ) == zeroXU.makeVector().transpose() );
+		integrate.addStatement( rk_eta.getCols( NX*(2+NX+NU),NX+diffsDim ) == zeros<double>( 1,(NX+NU)*(NX+NU+1)/2 ) );
+	}
+	else if( NU > 0 ) {
+		integrate.addStatement( rk_eta.getCols( 2*NX,2*NX+NU ) == zeros<double>( 1,NU ) );
+	}
+	integrate.addLinebreak( );
+
+	// integrator loop: FORWARD SWEEP
+	uint dim = numStages*NX2;
+	ExportForLoop loop( run, 0, grid.getNumIntervals() );
+
+	solveImplicitSystem( &loop, i, run1, j, tmp_index1, ExportIndex(0), Ah, C, determinant, true );
+
+	// factorization of the Newton matrix at the solution, which is saved for the backward sweep
+	loop.addStatement( determinant.getFullName() + " = " + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_b.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+	ExportForLoop loop1( i, 0, dim );
+	loop1.addStatement( rk_A_traj.getRow( run*dim+i ) == rk_A.getRow( i ) );
+	loop.addStatement( loop1 );
+	loop.addStatement( rk_aux_traj.getRow( run ) == rk_auxSolver.getRow( 0 ) );
+	ExportForLoop loop2( i, 0, numStages );
+	loop2.addStatement( rk_diffs_traj.getRow( run*numStages+i ) == rk_diffsTemp2.getRow( i ) );
+	loop.addStatement( loop2 );
+
+	if( SECOND_ORDER ) forwardSensitivities( &loop, run, i, j, k, tmp_index1, tmp_index2, Ah, Bh );
+
+	// update rk_eta:
+	for( run5 = 0; run5 < NX; run5++ ) {
+		loop.addStatement( rk_eta.getCol( run5 ) += rk_kkk.getRow( run5 )*Bh );
+	}
+
+	loop.addStatement( std::string( reset_int.get(0,0) ) + " = 0;\n" );
+	loop.addStatement( rk_ttt += DMatrix(1.0/grid.getNumIntervals()) );
+    // end of integrator loop: FORWARD SWEEP
+	integrate.addStatement( loop );
+
+	if( SECOND_ORDER && NU+NOD > 0 ) {
+		integrate.addStatement( rk_seed.getCols( 2*NX+NX*(NX+NU),2*NX+NX*(NX+NU)+NU+NOD ) == rk_xxx.getCols( NX,NX+NU+NOD ) );
+	}
+
+	// integrator loop: BACKWARD SWEEP
+	ExportForLoop loop3( run, grid.getNumIntervals(), 0, -1 );
+	adjointSensitivities( &loop3, run, i, j, k, tmp_index1, Bh );
+	loop3.addStatement( rk_ttt -= DMatrix(1.0/grid.getNumIntervals()) );
+    // end of integrator loop: BACKWARD SWEEP
+	integrate.addStatement( loop3 );
+
+    integrate.addStatement( std::string( "if( " ) + determinant.getFullName() + " < 1e-12 ) {\n" );
+    integrate.addStatement( error_code == 2 );
+    integrate.addStatement( std::string( "} else if( " ) + determinant.getFullName() + " < 1e-6 ) {\n" );
+    integrate.addStatement( error_code == 1 );
+    integrate.addStatement( std::string( "} else {\n" ) );
+    integrate.addStatement( error_code == 0 );
+    integrate.addStatement( std::string( "}\n" ) );
+
+	code.addFunction( integrate );
+    code.addLinebreak( 2 );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue AdjointIRKExport::setup( )
+{
+	int sensGen;
+	get( DYNAMIC_SENSITIVITY, sensGen );
+	SECOND_ORDER = ( (ExportSensitivityType)sensGen == THREE_SWEEPS );
+
+	returnValue returnvalue = ImplicitRungeKuttaExport::setup();
+	if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+	// the factorizations of the forward sweep are reused to solve the transposed systems:
+	if( solver ) {
+		solver->setTranspose( true );
+		solver->setup();
+	}
+
+	uint numH = (NX+NU)*(NX+NU+1)/2;
+	if( SECOND_ORDER ) diffsDim = NX + NX*(NX+NU) + numH;
+	else diffsDim = NX + NU;
+	inputDim = NX + diffsDim + NU + NOD;
+
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	ExportStruct structWspace;
+	structWspace = useOMP ? ACADO_LOCAL : ACADO_WORKSPACE;
+
+	uint numInts = grid.getNumIntervals();
+	uint dim = numStages*NX2;
+
+	rk_diffsTemp2 = ExportVariable( "rk_diffsTemp2", numStages, NX2*NVARS2, REAL, structWspace );
+	rk_A_traj = ExportVariable( "rk_A_traj", numInts*dim, dim, REAL, structWspace );
+	rk_aux_traj = ExportVariable( "rk_aux_traj", numInts, dim, INT, structWspace );
+	rk_diffs_traj = ExportVariable( "rk_diffs_traj", numInts*numStages, NX2*NVARS2, REAL, structWspace );
+	if( SECOND_ORDER ) {
+		rk_xxx_traj = ExportVariable( "rk_xxx_traj", numInts*numStages, NX, REAL, structWspace );
+		rk_S_traj = ExportVariable( "rk_S_traj", numInts*numStages, NX*(NX+NU), REAL, structWspace );
+		rk_seed = ExportVariable( "rk_seed", 1, 2*NX+NX*(NX+NU)+NU+NOD, REAL, structWspace );
+		rk_hess = ExportVariable( "rk_hess", 1, numH, REAL, structWspace );
+	}
+	rk_eta = ExportVariable( "rk_eta", 1, inputDim, REAL );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+// PROTECTED:
+
+
+returnValue AdjointIRKExport::forwardSensitivities( ExportStatementBlock* block, const ExportIndex& run, const ExportIndex& index1, const ExportIndex& index2, const ExportIndex& index3, const ExportIndex& tmp_index1, const ExportIndex& tmp_index2, const ExportVariable& Ah, const ExportVariable& Bh )
+{
+	uint i, run5;
+	ExportVariable C;
+
+	// save the stage values:
+	ExportForLoop loop0( index1, 0, numStages );
+	evaluateStatesImplicitSystem( &loop0, ExportIndex(0), Ah, C, index1, index2, tmp_index1 );
+	loop0.addStatement( rk_xxx_traj.getRow( run*numStages+index1 ) == rk_xxx.getCols( 0,NX ) );
+	block->addStatement( loop0 );
+
+	// the sensitivities with respect to the states (run5 == 0) and the control inputs (run5 == 1):
+	for( run5 = 0; run5 < 2; run5++ ) {
+		uint numDir = (run5 == 0) ? NX : NU;
+		uint offset = (run5 == 0) ? 0 : NX*NX;
+		if( numDir == 0 ) continue;
+
+		ExportForLoop loop1( index3, 0, numDir );
+		// column index3 of the sensitivities at the start of the integration step:
+		ExportForLoop loop11( index2, 0, NX );
+		loop11.addStatement( tmp_index2 == index2*numDir+index3 );
+		loop11.addStatement( rk_rhsTemp.getRow( index2 ) == rk_eta.getCol( tmp_index2+2*NX+offset ) );
+		loop1.addStatement( loop11 );
+
+		ExportForLoop loop12( index1, 0, numStages );
+		ExportForLoop loop13( index2, 0, NX );
+		loop13.addStatement( tmp_index1 == index1*NX+index2 );
+		loop13.addStatement( rk_b.getRow( tmp_index1 ) == rk_diffsTemp2.getSubMatrix( index1,index1+1,index2*NVARS2,index2*NVARS2+NX )*rk_rhsTemp.getRows( 0,NX ) );
+		if( run5 == 1 ) {
+			loop13.addStatement( tmp_index2 == index2*NVARS2+index3 );
+			loop13.addStatement( rk_b.getRow( tmp_index1 ) += rk_diffsTemp2.getElement( index1,tmp_index2+NX ) );
+		}
+		loop12.addStatement( loop13 );
+		loop1.addStatement( loop12 );
+
+		loop1.addFunctionCall( solver->getNameSolveReuseFunction(),rk_A.getAddress(0,0),rk_b.getAddress(0,0),rk_auxSolver.getAddress(0,0) );
+
+		// rk_b now contains minus the sensitivities of the stage variables:
+		ExportForLoop loop14( index1, 0, numStages );
+		loop14.addStatement( tmp_index1 == run*numStages+index1 );
+		ExportForLoop loop15( index2, 0, NX );
+		loop15.addStatement( tmp_index2 == index2*numDir+index3 );
+		loop15.addStatement( rk_S_traj.getElement( tmp_index1,tmp_index2+offset ) == rk_rhsTemp.getRow( index2 ) );
+		for( i = 0; i < numStages; i++ ) {
+			loop15.addStatement( rk_S_traj.getElement( tmp_index1,tmp_index2+offset ) -= Ah.getElement( index1,i )*rk_b.getRow( i*NX+index2 ) );
+		}
+		loop14.addStatement( loop15 );
+		loop1.addStatement( loop14 );
+
+		ExportForLoop loop16( index2, 0, NX );
+		loop16.addStatement( tmp_index2 == index2*numDir+index3 );
+		for( i = 0; i < numStages; i++ ) {
+			loop16.addStatement( rk_eta.getCol( tmp_index2+2*NX+offset ) -= rk_b.getRow( i*NX+index2 )*Bh.getRow( i ) );
+		}
+		loop1.addStatement( loop16 );
+
+		block->addStatement( loop1 );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue AdjointIRKExport::adjointSensitivities( ExportStatementBlock* block, const ExportIndex& run, const ExportIndex& index1, const ExportIndex& index2, const ExportIndex& index3, const ExportIndex& tmp_index1, const ExportVariable& Bh )
+{
+	uint i;
+	uint dim = numStages*NX2;
+
+	// the transposed system for the stage adjoints, with the factorization of integration step run-1:
+	for( i = 0; i < numStages; i++ ) {
+		ExportForLoop loop1( index2, 0, NX );
+		loop1.addStatement( rk_b.getRow( i*NX+index2 ) == Bh.getRow( i )*rk_eta.getCol( NX+index2 ) );
+		block->addStatement( loop1 );
+	}
+	block->addFunctionCall( solver->getNameSolveReuseTransposeFunction(),rk_A_traj.getAddress((run-1)*dim,0),rk_b.getAddress(0,0),rk_aux_traj.getAddress(run-1,0) );
+
+	// rk_b now contains minus the stage adjoints:
+	if( SECOND_ORDER ) {
+		ExportForLoop loop2( index1, 0, numStages );
+		loop2.addStatement( tmp_index1 == (run-1)*numStages+index1 );
+		loop2.addStatement( rk_seed.getCols( 0,NX ) == rk_xxx_traj.getRow( tmp_index1 ) );
+		ExportForLoop loop3( index2, 0, NX );
+		loop3.addStatement( rk_seed.getCol( NX+index2 ) == rk_b.getRow( index1*NX+index2 ) );
+		loop2.addStatement( loop3 );
+		loop2.addStatement( rk_seed.getCols( 2*NX,2*NX+NX*(NX+NU) ) == rk_S_traj.getRow( tmp_index1 ) );
+		loop2.addFunctionCall( diffs_sweep.getName(),rk_seed,rk_hess );
+		loop2.addStatement( rk_eta.getCols( NX*(2+NX+NU),NX+diffsDim ) -= rk_hess );
+		block->addStatement( loop2 );
+	}
+
+	ExportForLoop loop4( index1, 0, numStages );
+	loop4.addStatement( tmp_index1 == (run-1)*numStages+index1 );
+	ExportForLoop loop5( index2, 0, NX );
+	loop5.addStatement( rk_eta.getCols( NX,2*NX ) -= rk_b.getRow( index1*NX+index2 )*rk_diffs_traj.getSubMatrix( tmp_index1,tmp_index1+1,index2*NVARS2,index2*NVARS2+NX ) );
+	if( !SECOND_ORDER && NU > 0 ) {
+		loop5.addStatement( rk_eta.getCols( 2*NX,2*NX+NU ) -= rk_b.getRow( index1*NX+index2 )*rk_diffs_traj.getSubMatrix( tmp_index1,tmp_index1+1,index2*NVARS2+NX,index2*NVARS2+NX+NU ) );
+	}
+	loop4.addStatement( loop5 );
+	block->addStatement( loop4 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,203 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/code_generation/integrators/irk_adjoint_export.hpp
+ *    \author Rien Quirynen
+ *    \date 2014
+ */
+
+
+#ifndef ACADO_TOOLKIT_IRK_ADJOINT_EXPORT_HPP
+#define ACADO_TOOLKIT_IRK_ADJOINT_EXPORT_HPP
+
+#include <acado/code_generation/integrators/irk_export.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Allows to export a tailored implicit Runge-Kutta integrator with adjoint sensitivity propagation for fast model predictive control.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *	The class AdjointIRKExport allows to export a tailored implicit Runge-Kutta integrator with adjoint
+ *	sensitivity propagation for fast model predictive control. The forward sweep solves the collocation
+ *	equations and stores the factorized Newton matrix of every integration step. The backward sweep then
+ *	needs only one transposed solve with this factorization per step.
+ *
+ *	With the option BACKWARD, only the first order adjoint sensitivities are propagated. With THREE_SWEEPS,
+ *	the forward sweep also propagates the forward sensitivities and the backward sweep adds the second order
+ *	derivatives of the adjoint weighted model, with the same interface as ThreeSweepsERKExport. This is
+ *	supported for ODE models without linear input or output subsystems.
+ *
+ *	\author Rien Quirynen
+ */
+class AdjointIRKExport : public ImplicitRungeKuttaExport
+{
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+
+    public:
+
+		/** Default constructor.
+		 *
+		 *	@param[in] _userInteraction		Pointer to corresponding user interface.
+		 *	@param[in] _commonHeaderName	Name of common header file to be included.
+		 */
+        AdjointIRKExport(	UserInteraction* _userInteraction = 0,
+							const std::string& _commonHeaderName = ""
+							);
+
+		/** Copy constructor (deep copy).
+		 *
+		 *	@param[in] arg		Right-hand side object.
+		 */
+        AdjointIRKExport(	const AdjointIRKExport& arg
+							);
+
+        /** Destructor.
+		 */
+        virtual ~AdjointIRKExport( );
+
+
+		/** Assignment operator (deep copy).
+		 *
+		 *	@param[in] arg		Right-hand side object.
+		 */
+		AdjointIRKExport& operator=(	const AdjointIRKExport& arg
+										);
+
+
+		/** Assigns Differential Equation to be used by the integrator.
+		 *
+		 *	@param[in] rhs		Right-hand side expression.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue setDifferentialEquation( const Expression& rhs );
+
+
+		/** Initializes export of a tailored integrator.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue setup( );
+
+
+		/** Adds all data declarations of the auto-generated integrator to given list of declarations.
+		 *
+		 *	@param[in] declarations		List of declarations.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue getDataDeclarations(	ExportStatementBlock& declarations,
+													ExportStruct dataStruct = ACADO_ANY
+													) const;
+
+
+		/** Exports source code of the auto-generated integrator into the given directory.
+		 *
+		 *	@param[in] code				Code block containing the auto-generated integrator.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue getCode(	ExportStatementBlock& code
+										);
+
+
+	protected:
+
+
+		/** Exports the code needed to propagate the forward sensitivities through one integration step,
+		 *  using the factorized Newton matrix of that step.
+		 *
+		 *	@param[in] block			The block to which the code will be exported.
+		 *	@param[in] Ah				The variable containing the internal coefficients of the RK method, multiplied with the step size.
+		 *	@param[in] Bh				The variable containing the weights of the RK method, multiplied with the step size.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue forwardSensitivities(	ExportStatementBlock* block,
+											const ExportIndex& run,
+											const ExportIndex& index1,
+											const ExportIndex& index2,
+											const ExportIndex& index3,
+											const ExportIndex& tmp_index1,
+											const ExportIndex& tmp_index2,
+											const ExportVariable& Ah,
+											const ExportVariable& Bh 	);
+
+
+		/** Exports the code needed to propagate the adjoint (and second order) sensitivities backwards
+		 *  through one integration step, using the stored factorization of its Newton matrix.
+		 *
+		 *	@param[in] block			The block to which the code will be exported.
+		 *	@param[in] Bh				The variable containing the weights of the RK method, multiplied with the step size.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue adjointSensitivities(	ExportStatementBlock* block,
+											const ExportIndex& run,
+											const ExportIndex& index1,
+											const ExportIndex& index2,
+											const ExportIndex& index3,
+											const ExportIndex& tmp_index1,
+											const ExportVariable& Bh 	);
+
+
+		/** Returns the largest global export variable.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		ExportVariable getAuxVariable() const;
+
+
+    protected:
+
+		bool SECOND_ORDER;						/**< True if the second order sensitivities are propagated (THREE_SWEEPS). */
+
+		ExportAcadoFunction diffs_sweep;		/**< Module to export the second order derivatives of the adjoint weighted right-hand side. */
+
+		ExportVariable rk_A_traj;				/**< Variable containing the factorized Newton matrices of all integration steps. */
+		ExportVariable rk_aux_traj;				/**< Variable containing the row permutations of the factorized Newton matrices. */
+		ExportVariable rk_diffs_traj;			/**< Variable containing the Jacobians of the right-hand side at all stage values. */
+		ExportVariable rk_S_traj;				/**< Variable containing the forward sensitivities of all stage values. */
+		ExportVariable rk_xxx_traj;				/**< Variable containing all stage values of the forward sweep. */
+		ExportVariable rk_seed;					/**< Variable containing the input of the second order derivatives. */
+		ExportVariable rk_hess;					/**< Variable containing the second order derivatives of one stage. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_IRK_ADJOINT_EXPORT_HPP
+
+// end of file.
@@ -586,6 +586,7 @@ CLOSE_NAMESPACE_ACADO
 
 #include <acado/code_generation/integrators/irk_lifted_forward_export.hpp>
 #include <acado/code_generation/integrators/irk_forward_export.hpp>
+#include <acado/code_generation/integrators/irk_adjoint_export.hpp>
 #include <acado/code_generation/integrators/irk_export.ipp>
 
 
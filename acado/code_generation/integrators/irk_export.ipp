@@ -52,6 +52,9 @@ inline ImplicitRungeKuttaExport* createImplicitRungeKuttaExport(	UserInteraction
 	else if ( (ExportSensitivityType)sensGen == FORWARD ) {
 		return new ForwardIRKExport(_userInteraction, _commonHeaderName);
 	}
+	else if ( (ExportSensitivityType)sensGen == BACKWARD || (ExportSensitivityType)sensGen == THREE_SWEEPS ) {
+		return new AdjointIRKExport(_userInteraction, _commonHeaderName);
+	}
 	else if( (ExportSensitivityType)sensGen == NO_SENSITIVITY ) {
 		return new ImplicitRungeKuttaExport(_userInteraction, _commonHeaderName);
 	}
@@ -71,6 +71,9 @@ returnValue ExportGaussElim::getFunctionDeclarations(	ExportStatementBlock& decl
 	if( REUSE ) {
 		declarations.addDeclaration( solveReuse );
 	}
+	if( REUSE && TRANSPOSE ) {
+		declarations.addDeclaration( solveReuseTranspose );
+	}
 
 	return SUCCESSFUL_RETURN;
 }
@@ -81,7 +84,7 @@ returnValue ExportGaussElim::getCode(	ExportStatementBlock& code
 {
 
 	if (nRightHandSides > 0) {
-		if( !REUSE ) return ACADOERROR(RET_INVALID_OPTION);
+		if( !REUSE || TRANSPOSE ) return ACADOERROR(RET_INVALID_OPTION);
 
 		setupFactorization( solve, rk_swap, determinant, string("fabs") );
 		code.addFunction( solve );
@@ -101,6 +104,11 @@ returnValue ExportGaussElim::getCode(	ExportStatementBlock& code
 			setupSolveReuse( solveReuse, solveTriangular, rk_bPerm );
 			code.addFunction( solveReuse );
 		}
+		if( REUSE && TRANSPOSE ) { // And the function which solves the transposed system with this factorization
+
+			setupSolveReuseTranspose( solveReuseTranspose, rk_bPerm );
+			code.addFunction( solveReuseTranspose );
+		}
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -401,6 +409,41 @@ returnValue ExportGaussElim::setupSolveReuse( ExportFunction& _solveReuse, Expor
 }
 
 
+returnValue ExportGaussElim::setupSolveReuseTranspose( ExportFunction& _solveReuse, ExportVariable& _bPerm ) {
+
+	uint run1, run2;
+
+	if (nRightHandSides > 0)
+		return ACADOERROR(RET_INVALID_OPTION);
+
+	// A = P^T*L*U, so first solve the lower triangular system U^T*y = b:
+	for( run1 = 0; run1 < dim; run1++ ) {		// row run1
+		_solveReuse << _bPerm.get( run1,0 ) << " = b[" << toString( run1 ) << "];\n";
+		for( run2 = 0; run2 < run1; run2++ ) {	// column run2
+			_solveReuse << _bPerm.get( run1,0 ) << " -= A[" << toString( run2*dim+run1 ) << "]*" << _bPerm.getFullName() << "[" << toString( run2 ) << "];\n";
+		}
+		_solveReuse << _bPerm.get( run1,0 ) << " = " << _bPerm.getFullName() << "[" << toString( run1 ) << "]/A[" << toString( run1*dim+run1 ) << "];\n";
+		_solveReuse.addLinebreak();
+	}
+
+	// then the unit upper triangular system L^T*z = y (the multipliers are stored with a minus sign):
+	for( run1 = dim-1; run1 > 0; run1-- ) {		// row run1-1
+		for( run2 = run1; run2 < dim; run2++ ) {	// column run2
+			_solveReuse << _bPerm.get( run1-1,0 ) << " += A[" << toString( run2*dim+run1-1 ) << "]*" << _bPerm.getFullName() << "[" << toString( run2 ) << "];\n";
+		}
+		_solveReuse.addLinebreak();
+	}
+	_solveReuse.addLinebreak();
+
+	// and undo the row permutation:
+	for( run1 = 0; run1 < dim; run1++ ) {
+		_solveReuse << "b[" << rk_perm.getFullName() << "[" << toString( run1 ) << "]] = " << _bPerm.get( run1,0 ) << ";\n";
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ExportGaussElim::setupSolveReuseComplete( ExportFunction& _solveReuse, ExportVariable& _bPerm ) {
 
 	ExportIndex run1( "i" );
@@ -508,6 +551,10 @@ returnValue ExportGaussElim::setup( )
 		solveReuse = ExportFunction( getNameSolveReuseFunction(), A, b, rk_perm );
 		solveReuse.addLinebreak( );	// FIX: TO MAKE SURE IT GETS EXPORTED
 	}
+	if( REUSE && TRANSPOSE ) {
+		solveReuseTranspose = ExportFunction( getNameSolveReuseTransposeFunction(), A, b, rk_perm );
+		solveReuseTranspose.addLinebreak( );	// FIX: TO MAKE SURE IT GETS EXPORTED
+	}
 	
 	int unrollOpt;
 	userInteraction->get( UNROLL_LINEAR_SOLVER, unrollOpt );
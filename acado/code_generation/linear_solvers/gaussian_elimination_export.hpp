@@ -139,6 +139,7 @@ class ExportGaussElim : public ExportLinearSolver
 		virtual returnValue setupSolveReuse(	ExportFunction& _solveReuse, ExportFunction& _solveTriangular, ExportVariable& _bPerm );
 
 		virtual returnValue setupSolveReuseComplete(	ExportFunction& _solveReuse, ExportVariable& _bPerm );
+		virtual returnValue setupSolveReuseTranspose(	ExportFunction& _solveReuse, ExportVariable& _bPerm );
 
 
     protected:
@@ -48,6 +48,7 @@ ExportLinearSolver::ExportLinearSolver(	UserInteraction* _userInteraction,
 {
 	REUSE = true;
 	UNROLLING = false;
+	TRANSPOSE = false;
 	dim = nRows = nCols = nBacksolves = nRightHandSides = 0;
 
 	determinant = ExportVariable("det", 1, 1, REAL, ACADO_LOCAL, true);
@@ -157,6 +158,20 @@ returnValue ExportLinearSolver::setUnrolling( const bool& unrolling ) {
 } 
 
 
+bool ExportLinearSolver::getTranspose() const {
+	
+	return TRANSPOSE;
+}
+
+
+returnValue ExportLinearSolver::setTranspose( const bool& transpose ) {
+	
+	TRANSPOSE = transpose;
+	
+	return SUCCESSFUL_RETURN;
+} 
+
+
 const std::string ExportLinearSolver::getNameSolveFunction() {
 	
 	return string( "solve_" ) + identifier + "system";
@@ -168,6 +183,12 @@ const std::string ExportLinearSolver::getNameSolveReuseFunction() {
 	return string( "solve_" ) + identifier + "system_reuse";
 }
 
+
+const std::string ExportLinearSolver::getNameSolveReuseTransposeFunction() {
+	
+	return string( "solve_" ) + identifier + "system_reuse_transpose";
+}
+
 ExportVariable ExportLinearSolver::getGlobalExportVariable( const uint factor ) const
 {
 	ASSERT(1 == 0);
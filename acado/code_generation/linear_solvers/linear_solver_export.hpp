@@ -234,6 +234,24 @@ class ExportLinearSolver : public ExportAlgorithm
 		returnValue setUnrolling( const bool& unrolling );
 		
 		
+		/** Returns a boolean that is true when an extra algorithm will be exported to solve the transposed
+		 * 	linear system, reusing the factorization of the matrix.
+		 *
+		 *  \return A boolean that is true when an extra algorithm will be exported for the transposed system.
+		 */
+		bool getTranspose() const;
+		
+		
+		/** Sets the boolean that is true when an extra algorithm will be exported to solve the transposed
+		 * 	linear system, reusing the factorization of the matrix.
+		 * 
+		 * 	@param[in] transpose	The new value of this boolean.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setTranspose( const bool& transpose );
+		
+		
 		/** Returns a string containing the name of the function which is exported to solve the linear system.
 		 *
 		 *  \return A string containing the name of the function which is exported to solve the linear system.
@@ -248,6 +266,15 @@ class ExportLinearSolver : public ExportAlgorithm
 		 * 			the reuse of previous results.
 		 */
 		const std::string getNameSolveReuseFunction(); 
+		
+		
+		/** Returns a string containing the name of the function which is exported to solve the transposed linear
+		 * 	system with the reuse of previous results.
+		 *
+		 *  \return A string containing the name of the function which is exported to solve the transposed linear
+		 * 			system with the reuse of previous results.
+		 */
+		const std::string getNameSolveReuseTransposeFunction(); 
 
 
 	//
@@ -262,6 +289,7 @@ class ExportLinearSolver : public ExportAlgorithm
     
 		bool UNROLLING;						/**< The boolean that defines the unrolling. */
 		bool REUSE;							/**< The boolean that defines the reuse. */
+		bool TRANSPOSE;						/**< The boolean that defines the export of the transposed solve. */
 		uint dim;									/**< The dimensions of the linear system. */
 		
 		unsigned nRows;								/**< Number of rows of matrix A. */
@@ -276,6 +304,7 @@ class ExportLinearSolver : public ExportAlgorithm
 		ExportFunction solve;						/**< Function that solves the linear system. */
 		ExportFunction solveTriangular;				/**< Function that solves the upper-triangular system. */
 		ExportFunction solveReuse;					/**< Function that solves a linear system with the same matrix, reusing previous results. */
+		ExportFunction solveReuseTranspose;			/**< Function that solves the transposed linear system, reusing previous results. */
 
 		ExportVariable determinant;					/**< Variable containing the matrix determinant. */
 };
@@ -46,6 +46,10 @@
 #include <acado/objective/objective.hpp>
 #include <acado/ocp/ocp.hpp>
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
 using namespace std;
 
 BEGIN_NAMESPACE_ACADO
@@ -74,9 +78,27 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	get(QP_SOLVER, qpSolver);
 	string moduleName;
 	get(CG_MODULE_NAME, moduleName);
+	int useReentrantCode;
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+	int useBlockedLinearAlgebra;
+	get(CG_USE_BLOCKED_LINEAR_ALGEBRA, useBlockedLinearAlgebra);
+	int unrollingBudget;
+	get(CG_UNROLLING_BUDGET, unrollingBudget);
+	int codeSizeBudget;
+	get(CG_CODE_SIZE_BUDGET, codeSizeBudget);
 
 	acadoPrintCopyrightNotice( "Code Generation Tool" );
 
+	// In reentrant code, all exported functions take the context first
+	ExportArgumentList::setContextArgument( (bool)useReentrantCode );
+	ExportArithmeticStatement::setBlockedMultiplication( (bool)useBlockedLinearAlgebra );
+	ExportArithmeticStatement::setUnrollingBudget( unrollingBudget > 0 ? unrollingBudget : 0 );
+
+	codeSizeFiles.clear();
+	codeSizeFunctions.clear();
+	codeSizeBytes.clear();
+	codeSizeLines.clear();
+
 	//
 	// Create the export folders
 	//
@@ -109,10 +131,26 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 		ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
 				commonHeaderName, _realString, _intString, _precision);
 
+		int mixedPrecision;
+		get(CG_USE_MIXED_PRECISION, mixedPrecision);
+		if ( (bool)mixedPrecision == true )
+		{
+			// Type-generic math, such that the sensitivities are evaluated with the float variants
+			integratorFile.addStatement( "#ifndef __cplusplus\n#include <tgmath.h>\n#endif /* __cplusplus */\n\n" );
+		}
+
 		integrator->getCode( integratorFile );
 
-		if (integratorFile.exportCode( ) != SUCCESSFUL_RETURN)
+		std::vector< std::string > names;
+		std::vector< unsigned > bytes, lines;
+
+		if (integratorFile.exportCode(names, bytes, lines) != SUCCESSFUL_RETURN)
 			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+		codeSizeFiles.insert(codeSizeFiles.end(), names.size(), moduleName + "_integrator.c");
+		codeSizeFunctions.insert(codeSizeFunctions.end(), names.begin(), names.end());
+		codeSizeBytes.insert(codeSizeBytes.end(), bytes.begin(), bytes.end());
+		codeSizeLines.insert(codeSizeLines.end(), lines.begin(), lines.end());
 	}
 	else
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -127,8 +165,45 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 
 		solver->getCode( solverFile );
 
-		if ( solverFile.exportCode( ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+		std::vector< std::string > names;
+		std::vector< unsigned > bytes, lines;
+
+		//
+		// Halve the unrolling budget until the solver fits into the code size budget
+		//
+		ExportArithmeticStatement::setUnrollingBudget( unrollingBudget > 0 ? unrollingBudget : 0 );
+
+		while ( true )
+		{
+			if ( solverFile.exportCode(names, bytes, lines) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+			unsigned solverBytes = 0;
+			for (unsigned i = 0; i < bytes.size(); ++i)
+				solverBytes += bytes[ i ];
+
+			unsigned maxUnrolled = ExportArithmeticStatement::getMaxUnrolledStatements();
+
+			if (codeSizeBudget <= 0 || solverBytes <= (unsigned)codeSizeBudget)
+				break;
+
+			if (maxUnrolled < 2)
+			{
+				LOG( LVL_WARNING ) << "The code of the solver (" << solverBytes << " bytes) "
+						"exceeds the code size budget, although no more operations are unrolled." << endl;
+				break;
+			}
+
+			LOG( LVL_DEBUG ) << "Code of the solver: " << solverBytes << " bytes, limiting the number of "
+					"unrolled statements per function to " << maxUnrolled / 2 << endl;
+
+			ExportArithmeticStatement::setUnrollingBudget( maxUnrolled / 2 );
+		}
+
+		codeSizeFiles.insert(codeSizeFiles.end(), names.size(), moduleName + "_solver.c");
+		codeSizeFunctions.insert(codeSizeFunctions.end(), names.begin(), names.end());
+		codeSizeBytes.insert(codeSizeBytes.end(), bytes.begin(), bytes.end());
+		codeSizeLines.insert(codeSizeLines.end(), lines.begin(), lines.end());
 	}
 	else
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -145,7 +220,7 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 			dirName + string("/") + moduleName + "_auxiliary_functions.c",
 			moduleName
 			);
-	eaf.configure();
+	eaf.configure( (bool)useReentrantCode );
 	eaf.exportCode();
 
 	//
@@ -156,11 +231,17 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	int hessianApproximation;
 	get( HESSIAN_APPROXIMATION, hessianApproximation );
 
+	int qpSolution;
+	get(SPARSE_QP_SOLUTION, qpSolution);
+
 	if ( (bool)generateMakeFile == true )
 	{
 		str = dirName + "/Makefile";
 
-		switch ( (QPSolverName)qpSolver )
+		// The Riccati based QP solver is exported, independent of the QP solver option
+		if ( (SparseQPsolutionMethods)qpSolution == SPARSE_RICCATI )
+			acadoCopyTemplateFile(MAKEFILE_RICCATI, str, "#", true);
+		else switch ( (QPSolverName)qpSolver )
 		{
 			case QP_QPOASES:
 				if ( (HessianApproximationMode)hessianApproximation == EXACT_HESSIAN ) {
@@ -206,11 +287,17 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	//
 	// Generate MATLAB MEX interface
 	//
-	int qpSolution;
-	get(SPARSE_QP_SOLUTION, qpSolution);
 	int generateMexInterface;
 	get(GENERATE_MATLAB_INTERFACE, generateMexInterface);
-	if ( (bool)generateMexInterface == true )
+	if ( (bool)generateMexInterface == true && (bool)useReentrantCode == true )
+	{
+		ACADOWARNINGTEXT(RET_NOT_IMPLEMENTED_YET, "MEX interface is not yet available for reentrant code.");
+	}
+	else if ( (bool)generateMexInterface == true && (SparseQPsolutionMethods)qpSolution == SPARSE_RICCATI )
+	{
+		ACADOWARNINGTEXT(RET_NOT_IMPLEMENTED_YET, "MEX interface is not yet available for the Riccati based QP solver.");
+	}
+	else if ( (bool)generateMexInterface == true )
 	{
 		str = dirName + "/" + moduleName + "_solver_mex.c";
 
@@ -263,7 +350,11 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	get(GENERATE_SIMULINK_INTERFACE, generateSimulinkInterface);
 	if ((bool) generateSimulinkInterface == true)
 	{
-		if (!((QPSolverName)qpSolver == QP_QPOASES || (QPSolverName)qpSolver == QP_QPDUNES))
+		if ((bool)useReentrantCode == true)
+			ACADOWARNINGTEXT(RET_NOT_IMPLEMENTED_YET,
+					"Simulink interface is not yet available for reentrant code.");
+		else if (!((QPSolverName)qpSolver == QP_QPOASES || (QPSolverName)qpSolver == QP_QPDUNES) ||
+				(SparseQPsolutionMethods)qpSolution == SPARSE_RICCATI)
 			ACADOWARNINGTEXT(RET_NOT_IMPLEMENTED_YET,
 					"At the moment, Simulink interface is available only with qpOASES and qpDUNES based OCP solvers.");
 		else
@@ -312,13 +403,17 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	}
 
 	//
-	// Generate Symmetric EVD code
+	// Generate Hessian regularization code
 	//
 	if ( (HessianApproximationMode)hessianApproximation == EXACT_HESSIAN ) {
 //		LOG( LVL_DEBUG ) << "Exporting Hessian regularization code... " << endl;
+		int hessianRegularization;
+		get(CG_HESSIAN_REGULARIZATION, hessianRegularization);
+
 		ExportHessianRegularization evd(
 				dirName + string("/") + moduleName + "_hessian_regularization.c",
-				moduleName
+				moduleName,
+				(HessianRegularizationMode)hessianRegularization
 		);
 		evd.configure( ocp.getNX()+ocp.getNU(), 1e-12 );
 		if ( evd.exportCode() != SUCCESSFUL_RETURN )
@@ -342,6 +437,39 @@ returnValue OCPexport::printDimensionsQP( )
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue OCPexport::printCodeSizes( ) const
+{
+	unsigned totalBytes = 0;
+	for (unsigned i = 0; i < codeSizeBytes.size(); ++i)
+		totalBytes += codeSizeBytes[ i ];
+
+	if (totalBytes == 0)
+		return SUCCESSFUL_RETURN;
+
+	std::vector< std::pair< unsigned, unsigned > > order;
+	for (unsigned i = 0; i < codeSizeBytes.size(); ++i)
+		order.push_back( std::make_pair(codeSizeBytes[ i ], i) );
+	std::sort(order.rbegin(), order.rend());
+
+	stringstream report;
+	report << "ACADO Code Generation Tool, size of the exported code:" << endl;
+
+	for (unsigned k = 0; k < order.size(); ++k)
+	{
+		unsigned i = order[ k ].second;
+
+		report	<< "\t* " << setw( 10 ) << codeSizeBytes[ i ] << " bytes, "
+				<< setw( 7 ) << codeSizeLines[ i ] << " lines, "
+				<< fixed << setprecision( 1 ) << setw( 5 ) << 100.0 * codeSizeBytes[ i ] / totalBytes << "%: "
+				<< codeSizeFunctions[ i ] << " (" << codeSizeFiles[ i ] << ")" << endl;
+	}
+	report << "\t* " << setw( 10 ) << totalBytes << " bytes in total" << endl;
+
+	LOG( LVL_INFO ) << report.str();
+
+	return SUCCESSFUL_RETURN;
+}
+
 returnValue OCPexport::setup( )
 {
 	// Nothing to do as object is up-to-date
@@ -369,6 +497,18 @@ returnValue OCPexport::setup( )
 	int integratorType;
 	get(INTEGRATOR_TYPE, integratorType);
 
+	int mixedPrecision;
+	get(CG_USE_MIXED_PRECISION, mixedPrecision);
+	if ( (bool)mixedPrecision == true )
+	{
+		int sensitivityType;
+		get(DYNAMIC_SENSITIVITY, sensitivityType);
+
+		if ((ExportIntegratorType)integratorType > INT_RK4 || (ExportSensitivityType)sensitivityType != FORWARD)
+			return ACADOERRORTEXT(RET_INVALID_OPTION,
+					"Mixed precision is only supported for explicit Runge-Kutta integrators with forward sensitivities");
+	}
+
 	integrator = IntegratorExportPtr(
 			IntegratorExportFactory::instance().createAlgorithm(this, commonHeaderName, static_cast<ExportIntegratorType>(integratorType)));
 	if (integrator == 0)
@@ -391,6 +531,22 @@ returnValue OCPexport::setup( )
 	int hessianApproximation;
  	get( HESSIAN_APPROXIMATION, hessianApproximation );
 
+	int useReentrantCode;
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+	if ( (bool)useReentrantCode == true )
+	{
+		int useOMP;
+		get(CG_USE_OPENMP, useOMP);
+
+		if ((QPSolverName)qpSolver != QP_QPOASES || (HessianApproximationMode)hessianApproximation != GAUSS_NEWTON ||
+				(SparseQPsolutionMethods)qpSolution == SPARSE_RICCATI)
+			return ACADOERRORTEXT(RET_INVALID_OPTION,
+					"Reentrant code is only supported for Gauss-Newton solvers based on qpOASES");
+		if ((bool)useOMP == true)
+			return ACADOERRORTEXT(RET_INVALID_OPTION,
+					"Reentrant code cannot be combined with OpenMP; use one instance per thread instead");
+	}
+
 	// TODO Extend ExportNLPSolver ctor to accept OCP reference.
 
 	switch ( (SparseQPsolutionMethods)qpSolution )
@@ -430,9 +586,31 @@ returnValue OCPexport::setup( )
 
 	case BLOCK_CONDENSING_N2:
 
+		if ((QPSolverName)qpSolver == QP_QPOASES)
+		{
+			// A dense QP solver gains nothing from smaller blocks: condense the whole horizon
+			LOG( LVL_INFO ) << "Block condensing with qpOASES: condensing the whole horizon" << endl;
+
+			set(SPARSE_QP_SOLUTION, FULL_CONDENSING_N2);
+
+			if ( (HessianApproximationMode)hessianApproximation == GAUSS_NEWTON ) {
+				solver = ExportNLPSolverPtr(
+						NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, GAUSS_NEWTON_CN2));
+			}
+			else if ( (HessianApproximationMode)hessianApproximation == EXACT_HESSIAN ) {
+				solver = ExportNLPSolverPtr(
+						NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, EXACT_HESSIAN_CN2));
+			}
+			else {
+				return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "Only Gauss-Newton and Exact Hessian methods are currently supported");
+			}
+
+			break;
+		}
+
 		if ((QPSolverName)qpSolver != QP_QPDUNES && (QPSolverName)qpSolver != QP_FORCES)
 			return ACADOERRORTEXT(RET_INVALID_ARGUMENTS,
-					"For block condensed solution only qpDUNES QP solver is currently supported");
+					"For block condensed solution only qpOASES, qpDUNES and FORCES QP solvers are currently supported");
 
 		if ( (HessianApproximationMode)hessianApproximation == GAUSS_NEWTON && (QPSolverName)qpSolver == QP_QPDUNES ) {
 			solver = ExportNLPSolverPtr(
@@ -481,6 +659,17 @@ returnValue OCPexport::setup( )
 					NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, GAUSS_NEWTON_HPMPC));
 		break;
 
+	case SPARSE_RICCATI:
+
+		if ((HessianApproximationMode)hessianApproximation != GAUSS_NEWTON)
+			return ACADOERRORTEXT(RET_INVALID_ARGUMENTS,
+					"Only Gauss-Newton methods are currently supported in combination with the Riccati based QP solver");
+
+		solver = ExportNLPSolverPtr(
+				NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, GAUSS_NEWTON_RICCATI));
+
+		break;
+
 	default:
 		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "QP solver option is invalid");
 	}
@@ -589,6 +778,9 @@ returnValue OCPexport::collectFunctionDeclarations(	ExportStatementBlock& declar
 	if (solver->getFunctionDeclarations( declarations ) != SUCCESSFUL_RETURN)
 		return RET_UNABLE_TO_EXPORT_CODE;
 
+	if (solver->getProfilingDeclarations( declarations ) != SUCCESSFUL_RETURN)
+		return RET_UNABLE_TO_EXPORT_CODE;
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -618,6 +810,9 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 	int covCalc;
 	get(CG_COMPUTE_COVARIANCE_MATRIX, covCalc);
 
+	int useReentrantCode;
+	get(CG_USE_REENTRANT_CODE, useReentrantCode);
+
 	int linSolver;
 	get(LINEAR_ALGEBRA_SOLVER, linSolver);
 	bool useComplexArithmetic = false;
@@ -658,9 +853,35 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 			make_pair(toString( useAC ), "Providing interface for arrival cost.");
 	options[ "ACADO_COMPUTE_COVARIANCE_MATRIX" ] =
 			make_pair(toString( covCalc ), "Compute covariance matrix of the last state estimate.");
+	options[ "ACADO_REENTRANT" ] =
+			make_pair(toString( useReentrantCode ), "Indicator for reentrant code, i.e. all data is kept in the context passed to the functions.");
 	options[ "ACADO_QP_NV" ] =
 			make_pair(toString( solver->getNumQPvars() ), "Total number of QP optimization variables.");
 
+	options[ "ACADO_PROFILING" ] =
+			make_pair(toString( (unsigned)solver->usingProfiling() ), "Indicator for profiling of the phases of the RTI steps.");
+	if (solver->usingProfiling() == true)
+	{
+		stringstream names;
+		for (unsigned i = 0; i < PROFILE_NUM_PHASES; ++i)
+		{
+			string name = ExportNLPSolver::getProfilingPhaseName( (ExportProfilingPhase)i );
+			names << (i == 0 ? "{\"" : ", \"") << name << "\"";
+
+			transform(name.begin(), name.end(), name.begin(), ::toupper);
+			options[ "ACADO_PROFILE_" + name ] =
+					make_pair(toString( i ), "Index of a profiled phase of the RTI steps.");
+		}
+		names << "}";
+
+		options[ "ACADO_PROFILE_NUM_PHASES" ] =
+				make_pair(toString( (unsigned)PROFILE_NUM_PHASES ), "Number of profiled phases of the RTI steps.");
+		options[ "ACADO_PROFILE_NUM_SAMPLES" ] =
+				make_pair(toString( ExportNLPSolver::getProfilingNumSamples() ), "Number of most recent execution times of each phase for the percentiles.");
+		options[ "ACADO_PROFILE_NAMES" ] =
+				make_pair(names.str(), "Names of the profiled phases of the RTI steps.");
+	}
+
 	int qpSolution;
 	get(SPARSE_QP_SOLUTION, qpSolution);
 	if( (QPSolverName)qpSolver == QP_FORCES && (SparseQPsolutionMethods)qpSolution != BLOCK_CONDENSING_N2 ) {
@@ -710,9 +931,13 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 	functionsBlock.exportCode(functions, _realString);
 
+	// The Riccati based QP solver comes with the exported code, no QP solver is interfaced
+	if ((SparseQPsolutionMethods)qpSolution == SPARSE_RICCATI)
+		qpSolver = QP_NONE;
+
 	ExportCommonHeader ech(fileName, "", _realString, _intString, _precision);
 	ech.configure( moduleName, useSinglePrecision, useComplexArithmetic, (QPSolverName)qpSolver,
-			options, variables.str(), workspace.str(), functions.str());
+			options, variables.str(), workspace.str(), functions.str(), (bool)useReentrantCode);
 
 	return ech.exportCode();
 }
@@ -93,6 +93,13 @@ public:
 	 */
 	returnValue printDimensionsQP();
 
+	/** Prints the size of the code of each exported function of the last
+	 *  export, largest first, to show where the code volume comes from.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue printCodeSizes() const;
+
 protected:
 
 	/** Sets-up code export and initializes underlying export modules.
@@ -166,6 +173,12 @@ protected:
 
 	/** Internal copy of the OCP object. */
 	OCP ocp;
+
+	/** Exported files, functions, and their code size in bytes and lines. */
+	std::vector< std::string > codeSizeFiles;
+	std::vector< std::string > codeSizeFunctions;
+	std::vector< unsigned > codeSizeBytes;
+	std::vector< unsigned > codeSizeLines;
 };
 
 CLOSE_NAMESPACE_ACADO
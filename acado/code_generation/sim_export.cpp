@@ -111,6 +111,15 @@ returnValue SIMexport::exportCode(	const std::string& dirName,
 
 	string moduleName;
 	get(CG_MODULE_NAME, moduleName);
+	int useBlockedLinearAlgebra;
+	get(CG_USE_BLOCKED_LINEAR_ALGEBRA, useBlockedLinearAlgebra);
+	int unrollingBudget;
+	get(CG_UNROLLING_BUDGET, unrollingBudget);
+
+	// The integrator is exported with global data only
+	ExportArgumentList::setContextArgument( false );
+	ExportArithmeticStatement::setBlockedMultiplication( (bool)useBlockedLinearAlgebra );
+	ExportArithmeticStatement::setUnrollingBudget( unrollingBudget > 0 ? unrollingBudget : 0 );
 
 	//
 	// Create the export folders
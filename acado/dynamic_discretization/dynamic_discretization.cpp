@@ -191,6 +191,7 @@ returnValue DynamicDiscretization::setupOptions( ){
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( NUM_INTEGRATOR_THREADS      , defaultNumIntegratorThreads    );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
 
@@ -205,6 +206,9 @@ returnValue DynamicDiscretization::setupOptions( ){
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_UPDATE_CONVERGENCE_RATE, defaultJacobianUpdateConvergenceRate );
+	addOption( JACOBIAN_UPDATE_STEPSIZE_RATIO  , defaultJacobianUpdateStepsizeRatio   );
+	addOption( JACOBIAN_UPDATE_MAX_STEPS       , defaultJacobianUpdateMaxSteps        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 
@@ -425,6 +425,7 @@ returnValue IntegrationAlgorithm::setupOptions( )
 	
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , BT_FALSE                       );
+	addOption( NUM_INTEGRATOR_THREADS      , 1                              );
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
@@ -440,6 +441,9 @@ returnValue IntegrationAlgorithm::setupOptions( )
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_UPDATE_CONVERGENCE_RATE, defaultJacobianUpdateConvergenceRate );
+	addOption( JACOBIAN_UPDATE_STEPSIZE_RATIO  , defaultJacobianUpdateStepsizeRatio   );
+	addOption( JACOBIAN_UPDATE_MAX_STEPS       , defaultJacobianUpdateMaxSteps        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
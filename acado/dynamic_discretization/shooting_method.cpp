@@ -212,7 +212,6 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     ASSERT( iter.x != 0 );
 
     uint run1;
-    double tStart, tEnd;
 
     DVector x ;  nx = iter.getNX ();
     DVector xa;  na = iter.getNXA();
@@ -220,9 +219,6 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     DVector u ;  nu = iter.getNU ();
     DVector w ;  nw = iter.getNW ();
 
-	VariablesGrid xAll;
-	VariablesGrid xaAll;
-
     residuum = *(iter.x);
     residuum.setAll( 0.0 );
 
@@ -230,6 +226,44 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 // 	iter.x->print( "x" );
 // 	iter.u->print( "u" );
 
+	int freezeIntegrator;
+	get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+    for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
+
+        integrator[run1]->setOptions( getOptions( 0 ) );  // ??
+
+		if ( (BooleanType)freezeIntegrator == BT_TRUE )
+			integrator[run1]->freezeAll();
+    }
+
+    // INTEGRATE ALL INTERVALS CONCURRENTLY IF THEIR START VALUES ARE KNOWN:
+    // --------------------------------------------------------------------
+
+    std::vector< DVector > xStart, xaStart, pStart, uStart, wStart;
+
+    if ( getNumThreads( ) > 1 &&
+         getStartValues( iter, x, xa, p, u, w, xStart, xaStart, pStart, uStart, wStart ) == BT_TRUE )
+    {
+        std::vector< returnValue > status( unionGrid.getNumIntervals(), SUCCESSFUL_RETURN );
+
+        threadPool.run( unionGrid.getNumIntervals(), [&]( int idx ){
+            status[idx] = integrateInterval( idx, iter, xStart[idx], xaStart[idx], pStart[idx], uStart[idx], wStart[idx] );
+        } );
+
+        // The results are stored in the order of the intervals, as in the
+        // sequential loop below:
+        for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
+
+            if ( status[run1] != SUCCESSFUL_RETURN )
+                return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+            ACADO_TRY( storeInterval( run1, iter, x, xa, p, u, w ) );
+        }
+
+        return logTrajectory( iter );
+    }
+
     // RUN A LOOP OVER ALL INTERVALS OF THE UNION GRID:
     // ------------------------------------------------
 
@@ -238,91 +272,220 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 
     for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
 
-        integrator[run1]->setOptions( getOptions( 0 ) );  // ??
+        if ( integrateInterval( run1, iter, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
 
-		int freezeIntegrator;
-		get( FREEZE_INTEGRATOR, freezeIntegrator );
+        ACADO_TRY( storeInterval( run1, iter, x, xa, p, u, w ) );
+    }
 
-		if ( (BooleanType)freezeIntegrator == BT_TRUE )
-			integrator[run1]->freezeAll();
+    // LOG THE RESULTS:
+    // ----------------
+    return logTrajectory( iter );
+}
 
-        tStart = unionGrid.getTime( run1   );
-        tEnd   = unionGrid.getTime( run1+1 );
-		
-// 		printf("tStart = %e,   tEnd = %e\n",tStart,tEnd );
-// 		x.print("x");
-// 		u.print("u");
-// 		p.print("p");
 
-// 		integrator[run1]->set( INTEGRATOR_PRINTLEVEL, MEDIUM );
 
-		Grid evaluationGrid;
-		iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
-		
-        Grid outputGrid;
-		if ( acadoIsNegative( integrator[run1]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
-			outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
-		else
-			outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[run1]->getDifferentialEquationSampleTime() ) );
-
-// 		printf("evaluationGrid:\n");
-// 		evaluationGrid.print();
-// 		printf("outputGrid:\n");
-// 		outputGrid.print();
-// 		printf("evaluationGrid+outputGrid:\n");
-// 		(outputGrid&evaluationGrid).print();
-// 		printf("\n");
-// 		u.print("u before");
-// 		x.print("x before");
-// 		w.print("w");
-        if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+returnValue ShootingMethod::getIntervalGrids(	uint idx,
+												const OCPiterate &iter,
+												Grid &evaluationGrid,
+												Grid &outputGrid
+												) const
+{
+    double tStart = unionGrid.getTime( idx   );
+    double tEnd   = unionGrid.getTime( idx+1 );
 
-		
-		DVector xOld;
-		DVector pOld = p;
-		
-		if ( evaluationGrid.getNumPoints( ) <= 2 )
-		{
-			integrator[run1]->getX ( x  );
-			integrator[run1]->getXA( xa );
-// 			x.print("x after2");
-			xOld = x;
-			
-			iter.updateData( tEnd, x, xa, p, u, w );
-		}
-		else
-		{
-			integrator[run1]->getX (  xAll );
-			integrator[run1]->getXA( xaAll );
+	iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
+
+	if ( acadoIsNegative( integrator[idx]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
+		outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
+	else
+		outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[idx]->getDifferentialEquationSampleTime() ) );
+
+// 	printf("evaluationGrid:\n");
+// 	evaluationGrid.print();
+// 	printf("outputGrid:\n");
+// 	outputGrid.print();
+
+	return SUCCESSFUL_RETURN;
+}
 
-			xOld = xAll.getLastVector( );
-// 			xOld.print("x after");
-			
-			for( uint run2=1; run2<outputGrid.getNumPoints(); ++run2 )
+
+returnValue ShootingMethod::integrateInterval(	uint idx,
+												const OCPiterate &iter,
+												const DVector &x,
+												const DVector &xa,
+												const DVector &p,
+												const DVector &u,
+												const DVector &w
+												)
+{
+	Grid evaluationGrid, outputGrid;
+	getIntervalGrids( idx, iter, evaluationGrid, outputGrid );
+
+// 	integrator[idx]->set( INTEGRATOR_PRINTLEVEL, MEDIUM );
+
+	return integrator[idx]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w );
+}
+
+
+returnValue ShootingMethod::storeInterval(	uint idx,
+											OCPiterate &iter,
+											DVector &x,
+											DVector &xa,
+											DVector &p,
+											DVector &u,
+											DVector &w
+											)
+{
+	Grid evaluationGrid, outputGrid;
+	getIntervalGrids( idx, iter, evaluationGrid, outputGrid );
+
+	double tEnd = unionGrid.getTime( idx+1 );
+
+	DVector xOld;
+	DVector pOld = p;
+
+	if ( evaluationGrid.getNumPoints( ) <= 2 )
+	{
+		integrator[idx]->getX ( x  );
+		integrator[idx]->getXA( xa );
+		xOld = x;
+
+		iter.updateData( tEnd, x, xa, p, u, w );
+	}
+	else
+	{
+		VariablesGrid xAll;
+		VariablesGrid xaAll;
+
+		integrator[idx]->getX (  xAll );
+		integrator[idx]->getXA( xaAll );
+
+		xOld = xAll.getLastVector( );
+
+		for( uint run2=1; run2<outputGrid.getNumPoints(); ++run2 )
+		{
+			if ( evaluationGrid.hasTime( outputGrid.getTime(run2) ) == BT_TRUE )
 			{
-				if ( evaluationGrid.hasTime( outputGrid.getTime(run2) ) == BT_TRUE )
-				{
-					x  =  xAll.getVector(run2);
-					xa = xaAll.getVector(run2);
-					iter.updateData( outputGrid.getTime(run2), x, xa, p, u, w );
-				}
+				x  =  xAll.getVector(run2);
+				xa = xaAll.getVector(run2);
+				iter.updateData( outputGrid.getTime(run2), x, xa, p, u, w );
 			}
 		}
+	}
 
-		if ( iter.isInSimulationMode( ) == BT_FALSE )
-			p = pOld;  // should be changed later...
+	if ( iter.isInSimulationMode( ) == BT_FALSE )
+		p = pOld;  // should be changed later...
 
-        residuum.setVector( run1, xOld - x );
-// 		(xOld - x).print("residuum");
-    }
+	residuum.setVector( idx, xOld - x );
+// 	(xOld - x).print("residuum");
 
-    // LOG THE RESULTS:
-    // ----------------
-    return logTrajectory( iter );
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType ShootingMethod::getStartValues(	const OCPiterate &iter,
+											const DVector &x,
+											const DVector &xa,
+											const DVector &p,
+											const DVector &u,
+											const DVector &w,
+											std::vector< DVector > &xStart,
+											std::vector< DVector > &xaStart,
+											std::vector< DVector > &pStart,
+											std::vector< DVector > &uStart,
+											std::vector< DVector > &wStart
+											) const
+{
+	// In single shooting, or if the iterate has to be initialized by the
+	// integration, each interval starts at the result of its predecessor:
+	if ( iter.isInSimulationMode( ) == BT_TRUE )
+		return BT_FALSE;
+
+	uint nIntervals = unionGrid.getNumIntervals();
+
+	xStart.resize( nIntervals );
+	xaStart.resize( nIntervals );
+	pStart.resize( nIntervals );
+	uStart.resize( nIntervals );
+	wStart.resize( nIntervals );
+
+	xStart[0] = x;  xaStart[0] = xa;  pStart[0] = p;  uStart[0] = u;  wStart[0] = w;
+
+	for( uint run1 = 0; run1 < nIntervals; run1++ )
+	{
+		Grid evaluationGrid;
+		iter.x->getSubGrid( unionGrid.getTime( run1 ),unionGrid.getTime( run1+1 ),evaluationGrid );
+
+		// intermediate evaluation points update the iterate between the nodes
+		if ( evaluationGrid.getNumPoints( ) > 2 )
+			return BT_FALSE;
+
+		if ( run1 == 0 )
+			continue;
+
+		double tStart = unionGrid.getTime( run1 );
+
+		if ( getStartValue( iter.x , tStart, BT_TRUE , xStart[run1-1] , xStart[run1]  ) == BT_FALSE ||
+			 getStartValue( iter.xa, tStart, BT_TRUE , xaStart[run1-1], xaStart[run1] ) == BT_FALSE ||
+			 getStartValue( iter.p , tStart, BT_FALSE, pStart[run1-1] , pStart[run1]  ) == BT_FALSE ||
+			 getStartValue( iter.u , tStart, BT_FALSE, uStart[run1-1] , uStart[run1]  ) == BT_FALSE ||
+			 getStartValue( iter.w , tStart, BT_FALSE, wStart[run1-1] , wStart[run1]  ) == BT_FALSE )
+			return BT_FALSE;
+	}
+
+	return BT_TRUE;
+}
+
+
+BooleanType ShootingMethod::getStartValue(	const VariablesGrid *z,
+											double t,
+											BooleanType isState,
+											const DVector &previous,
+											DVector &start
+											) const
+{
+	if ( z == 0 )
+	{
+		start = previous;
+		return BT_TRUE;
+	}
+
+	if ( z->hasTime( t ) == BT_FALSE )
+	{
+		// states without node value are continued by the integration
+		if ( isState == BT_TRUE )
+			return BT_FALSE;
+
+		start = previous;
+		return BT_TRUE;
+	}
+
+	uint idx = z->getFloorIndex( t );
+
+	// auto-initialized values are (re-)computed from the integration result
+	if ( z->getAutoInit( idx ) == BT_TRUE )
+		return BT_FALSE;
+
+	start = z->getVector( idx );
+	return BT_TRUE;
 }
 
 
+int ShootingMethod::getNumThreads( )
+{
+	int numThreads = defaultNumIntegratorThreads;
+	get( NUM_INTEGRATOR_THREADS, numThreads );
+
+	if ( numThreads > (int)unionGrid.getNumIntervals() )
+		numThreads = unionGrid.getNumIntervals();
+
+	if ( numThreads > 1 )
+		threadPool.init( numThreads );
+
+	return numThreads;
+}
+
 
 returnValue ShootingMethod::differentiateBackward( const int    &idx ,
                                                    const DMatrix &seed,
@@ -468,24 +631,36 @@ returnValue ShootingMethod::evaluateSensitivities(){
 
     int i;
 
+    // The intervals are differentiated concurrently; their results are
+    // collected per interval and assembled afterwards in a fixed order.
+    getNumThreads( );
+    std::vector< returnValue > status( N, SUCCESSFUL_RETURN );
+
     // COMPUTATION OF BACKWARD SENSITIVITIES:
     // --------------------------------------
 
     if( bSeed.isEmpty() == BT_FALSE ){
 
+        std::vector< DMatrix > X( N ), P( N ), U( N ), W( N );
+
+        threadPool.run( N, [&]( int idx ){
+
+             DMatrix seed;
+             bSeed.getSubBlock( 0, idx, seed );
+
+             status[idx] = differentiateBackward( idx, seed, X[idx], P[idx], U[idx], W[idx] );
+        } );
+
         dBackward.init( N, 5 );
 
         for( i = 0; i < N; i++ ){
 
-             DMatrix seed, X, P, U, W;
-             bSeed.getSubBlock( 0, i, seed );
+             ACADO_TRY( status[i] );
 
-             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W ) );
-
-             if( nx > 0 ) dBackward.setDense( i, 0, X );
-             if( np > 0 ) dBackward.setDense( i, 2, P );
-             if( nu > 0 ) dBackward.setDense( i, 3, U );
-             if( nw > 0 ) dBackward.setDense( i, 4, W );
+             if( nx > 0 ) dBackward.setDense( i, 0, X[i] );
+             if( np > 0 ) dBackward.setDense( i, 2, P[i] );
+             if( nu > 0 ) dBackward.setDense( i, 3, U[i] );
+             if( nw > 0 ) dBackward.setDense( i, 4, W[i] );
         }
         return SUCCESSFUL_RETURN;
     }
@@ -494,21 +669,37 @@ returnValue ShootingMethod::evaluateSensitivities(){
     // COMPUTATION OF FORWARD SENSITIVITIES:
     // -------------------------------------
 
+    std::vector< DMatrix > DX( N ), DP( N ), DU( N ), DW( N );
+
+    threadPool.run( N, [&]( int idx ){
+
+        DMatrix X, P, U, W, E;
+
+        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( idx, 0, X );
+        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( idx, 0, P );
+        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( idx, 0, U );
+        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( idx, 0, W );
+
+        returnValue returnvalue = SUCCESSFUL_RETURN;
+
+        if( nx > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, X, E, E, E, DX[idx] );
+        if( np > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, E, P, E, E, DP[idx] );
+        if( nu > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, E, E, U, E, DU[idx] );
+        if( nw > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, E, E, E, W, DW[idx] );
+
+        status[idx] = returnvalue;
+    } );
+
     dForward.init( N, 5 );
 
     for( i = 0; i < N; i++ ){
 
-        DMatrix X, P, U, W, D, E;
-
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+        ACADO_TRY( status[i] );
 
-        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
-        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
-        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+        if( nx > 0 ) dForward.setDense( i, 0, DX[i] );
+        if( np > 0 ) dForward.setDense( i, 2, DP[i] );
+        if( nu > 0 ) dForward.setDense( i, 3, DU[i] );
+        if( nw > 0 ) dForward.setDense( i, 4, DW[i] );
     }
     return SUCCESSFUL_RETURN;
 }
@@ -589,62 +780,67 @@ returnValue ShootingMethod::evaluateSensitivitiesLifted( ){
 returnValue ShootingMethod::evaluateSensitivities( const BlockMatrix &seed, BlockMatrix &hessian ){
 
     const int NN = N+1;
-    dForward.init( N, 5 );
-    int i;
+    int i, j, k;
 
-    for( i = 0; i < N; i++ ){
+    // The intervals are differentiated concurrently: for each interval and
+    // each of the directions x, p, u and w, D holds the forward sensitivity
+    // and H the four blocks of the second order terms, which are assembled
+    // afterwards in a fixed order.
+    getNumThreads( );
+    std::vector< returnValue > status( N, SUCCESSFUL_RETURN );
+    std::vector< DMatrix > D( 4*N ), H( 16*N );
 
-        DMatrix X, P, U, W, D, E, HX, HP, HU, HW, S;
+    const int nDir[4] = { nx, np, nu, nw };
 
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+    threadPool.run( N, [&]( int idx ){
 
-        seed.getSubBlock( i, 0, S, nx, 1 );
+        DMatrix X, P, U, W, E, S;
 
-        if( nx > 0 ){
+        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( idx, 0, X );
+        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( idx, 0, P );
+        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( idx, 0, U );
+        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( idx, 0, W );
 
-            ACADO_TRY( differentiateForwardBackward( i, X, E, E, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 0, D );
+        seed.getSubBlock( idx, 0, S, nx, 1 );
 
-            if( nx > 0 ) hessian.addDense( i,      i, HX );
-            if( np > 0 ) hessian.addDense( i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( i, 4*NN+i, HW );
-        }
+        const DMatrix* dir[4][4] = { { &X, &E, &E, &E }, { &E, &P, &E, &E },
+                                     { &E, &E, &U, &E }, { &E, &E, &E, &W } };
+
+        for( int run1 = 0; run1 < 4; run1++ ){
 
-        if( np > 0 ){
+            if( nDir[run1] == 0 ) continue;
 
-            ACADO_TRY( differentiateForwardBackward( i, E, P, E, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 2, D );
+            DMatrix *h = &H[16*idx + 4*run1];
 
-            if( nx > 0 ) hessian.addDense( 2*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 2*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 2*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 2*NN+i, 4*NN+i, HW );
+            returnValue returnvalue = differentiateForwardBackward( idx,
+                    *dir[run1][0], *dir[run1][1], *dir[run1][2], *dir[run1][3], S,
+                    D[4*idx + run1], h[0], h[1], h[2], h[3] );
+
+            if( returnvalue != SUCCESSFUL_RETURN ){
+                status[idx] = returnvalue;
+                return;
+            }
         }
+    } );
 
-        if( nu > 0 ){
+    // Block offsets of x, p, u and w in the hessian:
+    const int offset[4] = { 0, 2*NN, 3*NN, 4*NN };
+    const int block[4] = { 0, 2, 3, 4 };
 
-            ACADO_TRY( differentiateForwardBackward( i, E, E, U, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 3, D );
+    dForward.init( N, 5 );
 
-            if( nx > 0 ) hessian.addDense( 3*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 3*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 3*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 3*NN+i, 4*NN+i, HW );
-        }
+    for( i = 0; i < N; i++ ){
+
+        ACADO_TRY( status[i] );
+
+        for( j = 0; j < 4; j++ ){
 
-        if( nw > 0 ){
+            if( nDir[j] == 0 ) continue;
 
-            ACADO_TRY( differentiateForwardBackward( i, E, E, E, W, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 4, D );
+            dForward.setDense( i, block[j], D[4*i + j] );
 
-            if( nx > 0 ) hessian.addDense( 4*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 4*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 4*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 4*NN+i, 4*NN+i, HW );
+            for( k = 0; k < 4; k++ )
+                if( nDir[k] > 0 ) hessian.addDense( offset[j]+i, offset[k]+i, H[16*i + 4*j + k] );
         }
     }
     return SUCCESSFUL_RETURN;
@@ -36,6 +36,7 @@
 
 
 #include <acado/dynamic_discretization/dynamic_discretization.hpp>
+#include <acado/utils/acado_thread_pool.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -205,6 +206,88 @@ class ShootingMethod : public DynamicDiscretization
 									double newIntervalLength
 									) const;
 
+			/** Sets up the grid of the iterate and the output grid of the \n
+			 *  integrator on the given interval.                           \n
+			 *                                                              \n
+			 *  \return SUCCESSFUL_RETURN                                   \n
+			 */
+			returnValue getIntervalGrids(	uint idx,
+											const OCPiterate &iter,
+											Grid &evaluationGrid,
+											Grid &outputGrid
+											) const;
+
+			/** Integrates the given interval from the given start values. \n
+			 *  Different intervals can be integrated concurrently.         \n
+			 *                                                              \n
+			 *  \return SUCCESSFUL_RETURN                                   \n
+			 *          or an error code of the integrator                  \n
+			 */
+			returnValue integrateInterval(	uint idx,
+											const OCPiterate &iter,
+											const DVector &x,
+											const DVector &xa,
+											const DVector &p,
+											const DVector &u,
+											const DVector &w
+											);
+
+			/** Stores the result of the integration of the given interval  \n
+			 *  in the iterate and the residuum, and updates the values at   \n
+			 *  the start of the next interval. Has to be called for all     \n
+			 *  intervals in their order.                                    \n
+			 *                                                               \n
+			 *  \return SUCCESSFUL_RETURN                                    \n
+			 */
+			returnValue storeInterval(	uint idx,
+										OCPiterate &iter,
+										DVector &x,
+										DVector &xa,
+										DVector &p,
+										DVector &u,
+										DVector &w
+										);
+
+			/** Determines the start values of all intervals without      \n
+			 *  integrating, starting from the given initial values. This   \n
+			 *  is possible if the iterate provides the values at all nodes \n
+			 *  (multiple shooting), but not if the states are initialized  \n
+			 *  or continued by the integration.                            \n
+			 *                                                              \n
+			 *  \return BT_TRUE iff the start values could be determined.   \n
+			 */
+			BooleanType getStartValues(	const OCPiterate &iter,
+										const DVector &x,
+										const DVector &xa,
+										const DVector &p,
+										const DVector &u,
+										const DVector &w,
+										std::vector< DVector > &xStart,
+										std::vector< DVector > &xaStart,
+										std::vector< DVector > &pStart,
+										std::vector< DVector > &uStart,
+										std::vector< DVector > &wStart
+										) const;
+
+			/** Determines the value of z at the start time t of an       \n
+			 *  interval, given its value at the start of the previous one. \n
+			 *                                                              \n
+			 *  \return BT_TRUE iff the value does not depend on the        \n
+			 *          integration of the previous interval.               \n
+			 */
+			BooleanType getStartValue(	const VariablesGrid *z,
+										double t,
+										BooleanType isState,
+										const DVector &previous,
+										DVector &start
+										) const;
+
+			/** Returns the number of threads for the integration of the \n
+			 *  intervals (option NUM_INTEGRATOR_THREADS) and starts the  \n
+			 *  thread pool accordingly.                                  \n
+			 */
+			int getNumThreads( );
+
         //
         // PROTECTED MEMBERS:
         //
@@ -213,6 +296,7 @@ class ShootingMethod : public DynamicDiscretization
 
             Integrator **integrator;
             DMatrix       breakPoints;
+            ThreadPool    threadPool ;   /**< Threads integrating the intervals concurrently. */
 };
 
 
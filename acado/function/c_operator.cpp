@@ -66,7 +66,7 @@ COperator::COperator( const CFunction &fcn, const Expression &arg, int component
     uint run1;
 
     cFunction = fcn;
-    argument  = arg;
+    argument  = arg.getDeepCopy();
 
     component = component_;
 
@@ -122,7 +122,7 @@ void COperator::copy( const COperator &arg ){
 
     bufferSize     = arg.bufferSize   ;
     cFunction      = arg.cFunction    ;
-    argument       = arg.argument     ;
+    argument       = arg.argument.getDeepCopy();
     component      = arg.component    ;
 
     first          = arg.first        ;
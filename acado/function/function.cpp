@@ -316,6 +316,11 @@ BooleanType Function::isDependingOn( const Expression     &variable ){
     return evaluationTree.isDependingOn( variable );
 }
 
+DMatrix Function::getDependencyPattern( const Expression &variable ){
+
+    return evaluationTree.getDependencyPattern( variable );
+}
+
 BooleanType Function::isLinearIn( const Expression     &variable ){
 
     return evaluationTree.isLinearIn( variable );
@@ -504,6 +509,28 @@ returnValue Function::exportCode(	std::ostream& stream,
 }
 
 
+returnValue Function::exportBatchCode(	std::ostream& stream,
+										const char *fcnName,
+										const char *realString,
+										uint        numPoints,
+										uint        _numX,
+										uint		_numXA,
+										uint		_numU,
+										uint		_numP,
+										uint		_numDX,
+										uint		_numOD,
+										bool       allocateMemory,
+										bool       staticMemory
+										) const
+{
+	if (getDim() > 0)
+		return evaluationTree.exportBatchCode(stream, fcnName, realString, numPoints,
+				_numX, _numXA, _numU, _numP, _numDX, _numOD, allocateMemory, staticMemory);
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Function::clearBuffer(){
 
     return evaluationTree.clearBuffer();
@@ -602,6 +629,31 @@ unsigned Function::getGlobalExportVariableSize( ) const
 	return evaluationTree.getGlobalExportVariableSize( );
 }
 
+returnValue Function::setExportContextArgument(const std::string& argument)
+{
+	return evaluationTree.setExportContextArgument( argument );
+}
+
+std::string Function::getExportContextArgument( ) const
+{
+	return evaluationTree.getExportContextArgument( );
+}
+
+int Function::getNumberOfEliminatedOperations( ) const
+{
+	return evaluationTree.getNumberOfEliminatedOperations( );
+}
+
+returnValue Function::setEvaluationMode( FunctionEvaluationMode evaluationMode_ )
+{
+	return evaluationTree.setEvaluationMode( evaluationMode_ );
+}
+
+FunctionEvaluationMode Function::getEvaluationMode( ) const
+{
+	return evaluationTree.getEvaluationMode( );
+}
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -268,6 +268,13 @@ public:
      BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Returns the structural (dim x variable.getDim()) dependency   \n
+     *  pattern of the function, which contains the sparsity pattern  \n
+     *  of its Jacobian with respect to the variable.                 \n
+     */
+     DMatrix getDependencyPattern( const Expression &variable );
+
+
 
     /** Checks whether the function is linear in                  \n
      *  (or not depending on)  var(index)                         \n
@@ -476,6 +483,26 @@ public:
 								bool       staticMemory   = false
 								) const;
 
+     /** Exports a batched variant of the function, which evaluates  \n
+      *  numPoints points with point-wise contiguous inputs and       \n
+      *  outputs (see FunctionEvaluationTree::exportBatchCode()).     \n
+      *                                                               \n
+      *  \return SUCCESFUL_RETURN                                     \n
+      */
+     returnValue exportBatchCode(	std::ostream& stream,
+									const char *fcnName,
+									const char *realString,
+									uint        numPoints,
+									uint        _numX = 0,
+									uint        _numXA = 0,
+									uint		_numU = 0,
+									uint		_numP = 0,
+									uint		_numDX = 0,
+									uint		_numOD = 0,
+									bool       allocateMemory = true,
+									bool       staticMemory   = false
+									) const;
+
      /** Clears the buffer and resets the buffer size \n
       *  to 1.                                        \n
       *  \return SUCCESFUL_RETURN                     \n
@@ -511,6 +538,30 @@ public:
      /** Get size of the variable that holds intermediate values. */
      unsigned getGlobalExportVariableSize( ) const;
 
+     /** Set the argument which precedes the input and output of the exported \n
+      *  functions, e.g. the context of a reentrant solver (empty: none).      \n
+      */
+     returnValue setExportContextArgument(const std::string& argument);
+
+     /** Get the argument which precedes the input and output of the exported functions. */
+     std::string getExportContextArgument( ) const;
+
+     /** Returns the number of operations that are saved in the exported  \n
+      *  code by common subexpression elimination.                         \n
+      */
+     int getNumberOfEliminatedOperations( ) const;
+
+     /** Selects whether the function is evaluated by walking the operator  \n
+      *  trees (FEM_TREE, default) or by interpreting a compiled flat       \n
+      *  instruction tape (FEM_TAPE). Both modes give identical results.    \n
+      *  \return SUCCESSFUL_RETURN                                          \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS                  \n
+      */
+     returnValue setEvaluationMode( FunctionEvaluationMode evaluationMode_ );
+
+     /** Returns the current evaluation mode. */
+     FunctionEvaluationMode getEvaluationMode( ) const;
+
 // PROTECTED MEMBERS:
 // ------------------
 
@@ -40,6 +40,26 @@ using namespace std;
 BEGIN_NAMESPACE_ACADO
 
 
+// The operators cast their constants to real_t. In functions of another
+// floating point type (e.g. the single precision model functions of mixed
+// precision solvers), the constants are cast to the type of the function,
+// such that the evaluation is not promoted to the precision of real_t.
+static string castConstants( const string& code, const char *realString ){
+
+	const string from( "(real_t)(" );
+	const string to = string( "(" ) + realString + ")(";
+
+	if (from == to)
+		return code;
+
+	string result( code );
+	for (size_t pos = result.find( from ); pos != string::npos; pos = result.find( from, pos + to.size() ))
+		result.replace(pos, from.size(), to);
+
+	return result;
+}
+
+
 
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -55,6 +75,8 @@ FunctionEvaluationTree::FunctionEvaluationTree( ){
     n         =  0;
 
     globalExportVariableName = "acado_aux";
+
+    evaluationMode = FEM_TREE;
 }
 
 FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& arg ){
@@ -65,6 +87,7 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
     n   = arg.n  ;
 
     globalExportVariableName = arg.globalExportVariableName;
+    exportContextArgument    = arg.exportContextArgument;
 
     if( arg.f == NULL ){
         f = NULL;
@@ -94,6 +117,9 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
     }
 
     safeCopy = arg.safeCopy;
+
+    evaluationMode = arg.evaluationMode;
+    tape           = arg.tape;
 }
 
 
@@ -155,6 +181,7 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
         n   = arg.n  ;
 
         globalExportVariableName = arg.globalExportVariableName;
+        exportContextArgument    = arg.exportContextArgument;
 
         if( arg.f == NULL ){
             f = NULL;
@@ -183,6 +210,9 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
             }
         }
         safeCopy = arg.safeCopy;
+
+        evaluationMode = arg.evaluationMode;
+        tape           = arg.tape;
     }
 
     return *this;
@@ -230,13 +260,16 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         dim++;
     }
-    return SUCCESSFUL_RETURN;
+    return compileTape();
 }
 
 
 
 returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.evaluate( 0, x, result );
+
     int run1;
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -283,6 +316,9 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result, PrintLe
 
 returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *result ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.evaluate( number, x, result );
+
     int run1;
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -390,6 +426,8 @@ FunctionEvaluationTree FunctionEvaluationTree::substitute( VariableType variable
     delete tmp.indexList;
     tmp.indexList = indexList->substitute(variableType_, index_);
 
+    tmp.setEvaluationMode( evaluationMode );
+
     return tmp;
 }
 
@@ -486,6 +524,41 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 }
 
 
+DMatrix FunctionEvaluationTree::getDependencyPattern( const Expression &variable ){
+
+    int nn = variable.getDim();
+
+    int run1, run2;
+    DMatrix pattern = zeros<double>( dim, nn );
+
+    VariableType varType;
+    int          component;
+    BooleanType *implicit_dep = new BooleanType [n];
+
+    for( run2 = 0; run2 < nn; run2++ ){
+
+        if( variable.element[run2]->isVariable( varType, component ) == BT_FALSE ||
+            varType == VT_INTERMEDIATE_STATE ){
+
+            delete[] implicit_dep;
+            pattern.setAll( 1.0 );
+            return pattern;
+        }
+
+        for( run1 = 0; run1 < n; run1++ ){
+            implicit_dep[run1] = sub[run1]->isDependingOn( 1, &varType, &component, implicit_dep );
+        }
+        for( run1 = 0; run1 < dim; run1++ ){
+            if( f[run1]->isDependingOn( 1, &varType, &component, implicit_dep ) == BT_TRUE )
+                pattern( run1, run2 ) = 1.0;
+        }
+    }
+
+    delete[] implicit_dep;
+    return pattern;
+}
+
+
 BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
     int nn = variable.getDim();
@@ -719,6 +792,9 @@ CurvatureType FunctionEvaluationTree::getCurvature( ){
 returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double *ff,
                                             double *df  ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_forward( 0, x, seed, ff, df );
+
     int run1;
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -738,6 +814,9 @@ returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double
 returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *seed,
                                             double *ff, double *df  ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_forward( number, x, seed, ff, df );
+
     int run1;
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -755,6 +834,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *s
 
 returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double *df  ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_forward( number, seed, df );
+
     int run1;
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -771,6 +853,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 
 returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_backward( 0, seed, df );
+
     int run1;
 
     for( run1 = dim-1; run1 >= 0; run1-- ){
@@ -792,6 +877,9 @@ returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
 
 returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, double  *df ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_backward( number, seed, df );
+
     int run1;
 
     for( run1 = dim-1; run1 >= 0; run1-- ){
@@ -812,6 +900,9 @@ returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
                                              double *dseed, double *df,
                                              double *ddf ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_forward2( number, seed, dseed, df, ddf );
+
     int run1;
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -830,6 +921,9 @@ returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
 returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, double *seed2,
                                               double *df, double  *ddf ){
 
+    if( evaluationMode == FEM_TAPE )
+        return tape.AD_backward2( number, seed1, seed2, df, ddf );
+
     int run1;
 
     for( run1 = dim-1; run1 >= 0; run1-- ){
@@ -877,8 +971,10 @@ returnValue FunctionEvaluationTree::exportForwardDeclarations(	std::ostream& str
 			" *  \\param in Input to the exported function.\n"
 			" *  \\param out Output of the exported function.\n"
 			" */\n"
-			<< "void " << fcnName << "(const " << realString << "* in, "
-			<< realString << "* out);" << endl;
+			<< "void " << fcnName << "(";
+	if (exportContextArgument.empty() == false)
+		stream << exportContextArgument << ", ";
+	stream	<< "const " << realString << "* in, " << realString << "* out);" << endl;
 
     return SUCCESSFUL_RETURN;
 }
@@ -897,6 +993,65 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 												bool       staticMemory
 												) const{
 
+	return exportFunctionCode(stream, fcnName, realString, 0,
+			_numX, _numXA, _numU, _numP, _numDX, _numOD, allocateMemory, staticMemory);
+}
+
+
+returnValue FunctionEvaluationTree::exportBatchCode(	std::ostream& stream,
+														const char *fcnName,
+														const char *realString,
+														uint        numPoints,
+														uint        _numX,
+														uint		_numXA,
+														uint		_numU,
+														uint		_numP,
+														uint		_numDX,
+														uint		_numOD,
+														bool       allocateMemory,
+														bool       staticMemory
+														) const{
+
+	if (numPoints == 0)
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	return exportFunctionCode(stream, fcnName, realString, numPoints,
+			_numX, _numXA, _numU, _numP, _numDX, _numOD, allocateMemory, staticMemory);
+}
+
+
+/** Returns the index of component idx; for batched functions, the index of \n
+ *  component idx of the current point k.                                   \n
+ */
+static string getExportIndex( int idx, uint numPoints ){
+
+	stringstream ss;
+
+	if (numPoints == 0)
+		ss << idx;
+	else if (idx == 0)
+		ss << "k";
+	else
+		ss << idx * numPoints << " + k";
+
+	return ss.str();
+}
+
+
+returnValue FunctionEvaluationTree::exportFunctionCode(	std::ostream& stream,
+														const char *fcnName,
+														const char *realString,
+														uint        numPoints,
+														uint        _numX,
+														uint		_numXA,
+														uint		_numU,
+														uint		_numP,
+														uint		_numDX,
+														uint		_numOD,
+														bool       allocateMemory,
+														bool       staticMemory
+														) const{
+
     int run1;
     int nni = 0;
 
@@ -911,53 +1066,63 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 	unsigned numDX = _numDX > 0 ? _numDX : getNDX();
 	unsigned numOD = _numOD > 0 ? _numOD : getNOD();
 
+	// Inputs, outputs and intermediate quantities of batched functions are
+	// stored point-wise contiguous:
+	unsigned stride = numPoints > 0 ? numPoints : 1;
 	unsigned offset = 0;
 
-	stream << "void " << fcnName << "(const " << realString << "* in, " << realString << "* out)\n{\n";
+	stream << "void " << fcnName << "(";
+	if (exportContextArgument.empty() == false)
+		stream << exportContextArgument << ", ";
+	stream << "const " << realString << "* in, " << realString << "* out)\n{\n";
 
 	if (numX > 0)
 		stream << "const " << realString << "* xd = in;" << endl;
 	offset += numX;
 
 	if (numXA > 0)
-		stream << "const " << realString << "* xa = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* xa = in + " << offset * stride << ";" << endl;
 	offset += numXA;
 
 	if (getNU() > 0)
-		stream << "const " << realString << "* u = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* u = in + " << offset * stride << ";" << endl;
 	offset += numU;
 
 	if (getNUI() > 0)
-		stream << "const " << realString << "* v = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* v = in + " << offset * stride << ";" << endl;
 	offset += getNUI();
 
 	if (numP > 0)
-		stream << "const " << realString << "* p = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* p = in + " << offset * stride << ";" << endl;
 	offset += numP;
 
 	if (getNOD() > 0)
-		stream << "const " << realString << "* od = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* od = in + " << offset * stride << ";" << endl;
 	offset += numOD;
 
 	if (getNPI() > 0)
-		stream << "const " << realString << "* q = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* q = in + " << offset * stride << ";" << endl;
 	offset += getNPI();
 
 	if (getNW() > 0)
-		stream << "const " << realString << "* w = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* w = in + " << offset * stride << ";" << endl;
 	offset += getNW();
 
 	if (numDX > 0)
-		stream << "const " << realString << "* dx = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* dx = in + " << offset * stride << ";" << endl;
 	offset += numDX;
 
 	if (getNT() > 0)
-		stream << "const " << realString << "* t = in + " << offset << ";" << endl;
+		stream << "const " << realString << "* t = in + " << offset * stride << ";" << endl;
 	offset += getNT();
 
-    if (n > 0)
+    // Hoist common subexpressions of all trees into further auxiliary variables
+    OperatorCSE cse;
+    int nAux = n + getCommonSubexpressions( cse );
+
+    if (nAux > 0)
     {
-    	stream << "/* Vector of auxiliary variables; number of elements: " << n << ". */" << endl;
+    	stream << "/* Vector of auxiliary variables; number of elements: " << nAux << ". */" << endl;
 
     	if ( allocateMemory )
     	{
@@ -965,25 +1130,43 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
     		{
     			stream << "static ";
     		}
-    		stream << realString << " a[" << n << "];";
+    		stream << realString << " a[" << nAux * stride << "];";
     	}
     	else
     		stream << realString << "* a = " << globalExportVariableName << ";";
     	stream << endl << endl;
 
+    	if (cse.getNumberOfEliminatedOperations() > 0)
+    		stream << "/* Common subexpressions: " << cse.getNumberOfAuxiliaryVariables()
+    			<< " auxiliary variables, " << cse.getNumberOfEliminatedOperations() << " of "
+    			<< cse.getNumberOfOperations() << " operations eliminated. */" << endl;
+
+    	if (numPoints == 0)
+    		stream << "/* Compute intermediate quantities: */" << endl;
+    }
+
+    if (numPoints > 0)
+    {
+    	stream << "int k;" << endl << endl;
+    	stream << "for (k = 0; k < " << numPoints << "; ++k)" << endl << "{" << endl;
     	stream << "/* Compute intermediate quantities: */" << endl;
     }
 
+    // Refer to the variables of batched functions at the current point
+    if (numPoints > 0)
+    	setBatchExportNames( numPoints );
+
     vector< string > auxVarIndividualNames;
     auxVarIndividualNames.resize( nni );
 	for (run1 = 0; run1 < n; run1++)
 	{
 		stringstream ss;
-		ss << "a" << "[" << run1 << "]";
+		ss << "a" << "[" << getExportIndex(run1, numPoints) << "]";
 		auxVarIndividualNames[ lhs_comp[ run1 ] ] = ss.str();
 	}
 
-	IoFormatter iof( stream );
+	stringstream body;
+	IoFormatter iof( body );
 	iof.set(16, iof.width, ios::scientific);
 
 	// Export intermediate quantities
@@ -992,20 +1175,29 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 		// Convert the name for intermediate variables for subexpressions
 		sub[run1]->setVariableExportName(VT_INTERMEDIATE_STATE, auxVarIndividualNames);
 
-		stream << "a[" << run1 << "] = " << *sub[ run1 ] << ";" << endl;
+		cse.exportAuxiliaryVariables(body, run1, "a", stride, numPoints > 0 ? "k" : "");
+		body << "a[" << getExportIndex(run1, numPoints) << "] = " << *sub[ run1 ] << ";" << endl;
 	}
 
 	// Export output quantities
-	stream << endl << "/* Compute outputs: */" << endl;
+	body << endl << "/* Compute outputs: */" << endl;
 	for (run1 = 0; run1 < dim; run1++)
 	{
 		// Convert names for interm. quantities for output expressions
 		f[run1]->setVariableExportName(VT_INTERMEDIATE_STATE, auxVarIndividualNames);
 
-		stream << "out[" << run1 << "] = " << *f[ run1 ] << ";" << endl;
+		cse.exportAuxiliaryVariables(body, n + run1, "a", stride, numPoints > 0 ? "k" : "");
+		body << "out[" << getExportIndex(run1, numPoints) << "] = " << *f[ run1 ] << ";" << endl;
 	}
 
-	iof.reset();
+	stream << castConstants(body.str(), realString);
+	cse.clearAliases();
+
+	if (numPoints > 0)
+	{
+		setBatchExportNames( 0 );
+		stream << "}" << endl;
+	}
 
 	stream << "}" << endl << endl;
 
@@ -1013,11 +1205,43 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 }
 
 
+void FunctionEvaluationTree::setBatchExportNames( uint numPoints ) const{
+
+	const int nTypes = 10;
+
+	const VariableType types[ nTypes ] = { VT_DIFFERENTIAL_STATE, VT_ALGEBRAIC_STATE, VT_CONTROL,
+			VT_INTEGER_CONTROL, VT_PARAMETER, VT_ONLINE_DATA, VT_INTEGER_PARAMETER, VT_DISTURBANCE,
+			VT_DDIFFERENTIAL_STATE, VT_TIME };
+	const char* names[ nTypes ] = { "xd", "xa", "u", "v", "p", "od", "q", "w", "dx", "t" };
+	const int nVariables[ nTypes ] = { getNX(), getNXA(), getNU(), getNUI(), getNP(), getNOD(),
+			getNPI(), getNW(), getNDX(), getNT() };
+
+	int run1, run2, run3;
+
+	for (run1 = 0; run1 < nTypes; run1++)
+	{
+		if (nVariables[ run1 ] == 0)
+			continue;
+
+		vector< string > exportNames( nVariables[ run1 ] );
+		for (run2 = 0; run2 < nVariables[ run1 ]; run2++)
+			exportNames[ run2 ] = string( names[ run1 ] ) + "[" + getExportIndex(run2, numPoints) + "]";
+
+		for (run3 = 0; run3 < n; run3++)
+			sub[ run3 ]->setVariableExportName(types[ run1 ], exportNames);
+		for (run3 = 0; run3 < dim; run3++)
+			f[ run3 ]->setVariableExportName(types[ run1 ], exportNames);
+	}
+}
+
+
 returnValue FunctionEvaluationTree::clearBuffer(){
 
     int run1;
     returnValue returnvalue;
 
+    tape.clearBuffer();
+
     for( run1 = 0; run1 < n; run1++ ){
         returnvalue = sub[run1]->clearBuffer();
         if( returnvalue != SUCCESSFUL_RETURN ){
@@ -1059,7 +1283,7 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
         delete tmp;
     }
 
-    return SUCCESSFUL_RETURN;
+    return compileTape();
 }
 
 
@@ -1168,6 +1392,54 @@ returnValue FunctionEvaluationTree::setGlobalExportVariableName(const std::strin
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue FunctionEvaluationTree::setEvaluationMode( FunctionEvaluationMode evaluationMode_ )
+{
+	if ( evaluationMode_ == FEM_TAPE && isSymbolic() == BT_FALSE )
+		return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+	evaluationMode = evaluationMode_;
+
+	return compileTape();
+}
+
+FunctionEvaluationMode FunctionEvaluationTree::getEvaluationMode( ) const
+{
+	return evaluationMode;
+}
+
+const OperatorTape& FunctionEvaluationTree::getTape( ) const
+{
+	return tape;
+}
+
+returnValue FunctionEvaluationTree::compileTape( )
+{
+	if ( evaluationMode != FEM_TAPE )
+	{
+		tape.clear();
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( isSymbolic() == BT_FALSE )
+	{
+		evaluationMode = FEM_TREE;
+		tape.clear();
+		return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+	}
+
+	int run1;
+	int *subIndex = new int[n+1];
+
+	for( run1 = 0; run1 < n; run1++ )
+		subIndex[run1] = indexList->index( VT_INTERMEDIATE_STATE,lhs_comp[run1] );
+
+	returnValue returnvalue = tape.compile( n,sub,subIndex,dim,f );
+
+	delete[] subIndex;
+
+	return returnvalue;
+}
+
 std::string FunctionEvaluationTree::getGlobalExportVariableName() const
 {
 	return globalExportVariableName;
@@ -1175,7 +1447,56 @@ std::string FunctionEvaluationTree::getGlobalExportVariableName() const
 
 unsigned FunctionEvaluationTree::getGlobalExportVariableSize() const
 {
-	return n;
+	OperatorCSE cse;
+	return n + getCommonSubexpressions( cse );
+}
+
+returnValue FunctionEvaluationTree::setExportContextArgument(const std::string& _argument)
+{
+	exportContextArgument = _argument;
+
+	return SUCCESSFUL_RETURN;
+}
+
+std::string FunctionEvaluationTree::getExportContextArgument() const
+{
+	return exportContextArgument;
+}
+
+int FunctionEvaluationTree::getNumberOfEliminatedOperations() const
+{
+	OperatorCSE cse;
+	getCommonSubexpressions( cse );
+
+	return cse.getNumberOfEliminatedOperations();
+}
+
+int FunctionEvaluationTree::getCommonSubexpressions( OperatorCSE& cse ) const
+{
+	if ( isSymbolic() == BT_FALSE || n + dim == 0 )
+		return 0;
+
+	int run1;
+	Operator **roots = new Operator*[n + dim];
+	int *subIndex = new int[n + 1];
+
+	for (run1 = 0; run1 < n; run1++)
+	{
+		roots[run1] = sub[run1];
+		subIndex[run1] = indexList->index( VT_INTERMEDIATE_STATE,lhs_comp[run1] );
+	}
+	for (run1 = 0; run1 < dim; run1++)
+		roots[n + run1] = f[run1];
+
+	returnValue returnvalue = cse.analyze( n + dim, roots, n, subIndex );
+
+	delete[] subIndex;
+	delete[] roots;
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return 0;
+
+	return cse.getNumberOfAuxiliaryVariables();
 }
 
 CLOSE_NAMESPACE_ACADO
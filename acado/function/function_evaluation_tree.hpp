@@ -37,6 +37,8 @@
 #include <acado/symbolic_expression/expression.hpp>
 #include <acado/symbolic_operator/evaluation_template.hpp>
 #include <acado/symbolic_operator/symbolic_index_list.hpp>
+#include <acado/symbolic_operator/operator_tape.hpp>
+#include <acado/symbolic_operator/operator_cse.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -241,6 +243,18 @@ public:
      virtual BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Returns the structural dependency pattern of the function, i.e.  \n
+     *  a (dim x variable.getDim()) matrix whose entry (i,j) is one if    \n
+     *  the i-th component of the function depends on the j-th component \n
+     *  of the variable and zero otherwise. The pattern is determined     \n
+     *  from the operator trees without evaluation, hence it contains     \n
+     *  the sparsity pattern of the Jacobian. If the variable contains    \n
+     *  intermediate states or non-variable components, all entries are   \n
+     *  set to one.                                                       \n
+     */
+     virtual DMatrix getDependencyPattern( const Expression &variable );
+
+
     /** Checks whether the symbolic expression is linear in       \n
      *  a specified variable.                                     \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -432,6 +446,28 @@ public:
 								bool       staticMemory   = false
 								) const;
 
+    /** Exports a batched variant of the function, which evaluates     \n
+     *  numPoints points at once. Inputs and outputs are stored point-  \n
+     *  wise contiguous, i.e. component i of point k is in[i*numPoints  \n
+     *  + k] and out[i*numPoints + k], so that the loop over the points \n
+     *  can be vectorized by the compiler.                              \n
+     *                                                                  \n
+     *  \return SUCCESFUL_RETURN                                        \n
+     */
+     returnValue exportBatchCode(	std::ostream& stream,
+									const char *fcnName,
+									const char *realString,
+									uint       numPoints,
+									uint       _numX = 0,
+									uint	   _numXA = 0,
+									uint       _numU = 0,
+									uint       _numP = 0,
+									uint       _numDX = 0,
+									uint       _numOD = 0,
+									bool       allocateMemory = true,
+									bool       staticMemory   = false
+									) const;
+
      /** Clears the buffer and resets the buffer size \n
       *  to 1.                                        \n
       *  \return SUCCESFUL_RETURN                     \n
@@ -458,6 +494,22 @@ public:
      /** Defines scalings for the variables. */
      virtual returnValue setScale( double *scale_ );
 
+
+     /** Selects how the function is evaluated numerically. With FEM_TAPE   \n
+      *  the operator trees are compiled into a flat instruction tape that  \n
+      *  is used by evaluate, AD_forward, AD_backward and their 2nd order   \n
+      *  counterparts.                                                      \n
+      *  \return SUCCESSFUL_RETURN                                          \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS                  \n
+      */
+     returnValue setEvaluationMode( FunctionEvaluationMode evaluationMode_ );
+
+     /** Returns the current evaluation mode. */
+     FunctionEvaluationMode getEvaluationMode( ) const;
+
+     /** Returns the compiled instruction tape (empty in FEM_TREE mode). */
+     const OperatorTape& getTape( ) const;
+
      virtual returnValue getExpression( Expression& expression ) const;
 
      returnValue setGlobalExportVariableName(const std::string& _name);
@@ -466,6 +518,53 @@ public:
 
      unsigned getGlobalExportVariableSize() const;
 
+     returnValue setExportContextArgument(const std::string& _argument);
+
+     std::string getExportContextArgument() const;
+
+     /** Returns the number of operations that are saved in the exported  \n
+      *  code by common subexpression elimination.                         \n
+      */
+     int getNumberOfEliminatedOperations() const;
+
+     //
+     // PROTECTED MEMBER FUNCTIONS:
+     //
+protected:
+
+     /** (Re-)compiles the instruction tape if the tape mode is selected. */
+     returnValue compileTape( );
+
+     /** Analyses the common subexpressions of the intermediate and output \n
+      *  expressions for the code export.                                  \n
+      *  \return the number of additional auxiliary variables              \n
+      */
+     int getCommonSubexpressions( OperatorCSE& cse ) const;
+
+     /** Exports the function code; for numPoints > 0 the batched \n
+      *  variant is exported (see exportBatchCode()).              \n
+      *  \return SUCCESFUL_RETURN                                  \n
+      */
+     returnValue exportFunctionCode(	std::ostream& stream,
+										const char *fcnName,
+										const char *realString,
+										uint       numPoints,
+										uint       _numX,
+										uint	   _numXA,
+										uint       _numU,
+										uint       _numP,
+										uint       _numDX,
+										uint       _numOD,
+										bool       allocateMemory,
+										bool       staticMemory
+										) const;
+
+     /** Sets the export names of all input variables to name[i] or, \n
+      *  for numPoints > 0, to name[i*numPoints + k].                 \n
+      */
+     void setBatchExportNames( uint numPoints ) const;
+
+
      //
      // DATA MEMBERS:
      //
@@ -480,8 +579,14 @@ protected:
 
      Expression           safeCopy ;
 
+     FunctionEvaluationMode evaluationMode;   /**< The evaluation mode.               */
+     OperatorTape           tape          ;   /**< The compiled instruction tape.     */
+
      /** Name of the variable that holds intermediate expressions. */
      std::string		globalExportVariableName;
+
+     /** Argument which precedes the input and output of exported functions. */
+     std::string		exportContextArgument;
 };
 
 
@@ -0,0 +1,190 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file src/function/jacobian_coloring.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#include <acado/function/jacobian_coloring.hpp>
+
+#include <algorithm>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// LOCAL HELPER FUNCTIONS:
+//
+
+/* Orders the columns by decreasing number of nonzeros (ties by index). */
+struct JacobianColoringOrder{
+
+	const vector< int > *nnz;
+
+	bool operator()( int a, int b ) const{
+
+		if( (*nnz)[a] != (*nnz)[b] ) return (*nnz)[a] > (*nnz)[b];
+		return a < b;
+	}
+};
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+JacobianColoring::JacobianColoring( ){
+
+    nRows   = 0;
+    nCols   = 0;
+    nColors = 0;
+}
+
+
+JacobianColoring::JacobianColoring( const DMatrix &pattern ){
+
+    init( pattern );
+}
+
+
+JacobianColoring::~JacobianColoring( ){
+
+}
+
+
+returnValue JacobianColoring::init( const DMatrix &pattern ){
+
+    int run1, run2, run3;
+
+    nRows   = pattern.getNumRows();
+    nCols   = pattern.getNumCols();
+    nColors = 0;
+
+    // ROW- AND COLUMN-WISE LISTS OF THE NONZERO ENTRIES:
+    // --------------------------------------------------
+    vector< vector< int > > rowNonzeros( nRows );
+    vector< vector< int > > colNonzeros( nCols );
+    vector< int >           nnz        ( nCols );
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+        for( run2 = 0; run2 < nCols; run2++ ){
+            if( fabs( pattern(run1,run2) ) > 0.0 ){
+                rowNonzeros[run1].push_back( run2 );
+                colNonzeros[run2].push_back( run1 );
+            }
+        }
+    }
+
+    vector< int > order( nCols );
+    for( run2 = 0; run2 < nCols; run2++ ){
+        order[run2] = run2;
+        nnz  [run2] = (int) colNonzeros[run2].size();
+    }
+
+    JacobianColoringOrder largestFirst;
+    largestFirst.nnz = &nnz;
+    stable_sort( order.begin(), order.end(), largestFirst );
+
+
+    // GREEDY COLORING: EACH COLUMN GETS THE SMALLEST COLOR THAT IS NOT
+    // USED BY A COLUMN WITH A NONZERO ENTRY IN A COMMON ROW:
+    // -----------------------------------------------------------------
+    color.assign( nCols, -1 );
+    vector< int > forbidden( nCols, -1 );
+
+    for( run1 = 0; run1 < nCols; run1++ ){
+
+        const int col = order[run1];
+
+        for( run2 = 0; run2 < (int) colNonzeros[col].size(); run2++ ){
+            const int row = colNonzeros[col][run2];
+            for( run3 = 0; run3 < (int) rowNonzeros[row].size(); run3++ ){
+                const int c = color[ rowNonzeros[row][run3] ];
+                if( c >= 0 ) forbidden[c] = col;
+            }
+        }
+
+        int c = 0;
+        while( forbidden[c] == col ) c++;
+
+        color[col] = c;
+        if( c >= nColors ) nColors = c+1;
+    }
+
+
+    // RECOVERY TABLE:
+    // ---------------
+    rowColumn.assign( nRows*nColors, -1 );
+
+    for( run2 = 0; run2 < nCols; run2++ )
+        for( run1 = 0; run1 < (int) colNonzeros[run2].size(); run1++ )
+            rowColumn[ colNonzeros[run2][run1]*nColors + color[run2] ] = run2;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+DMatrix JacobianColoring::getSeedMatrix( ) const{
+
+    DMatrix seed = zeros<double>( nCols, nColors );
+
+    for( int run1 = 0; run1 < nCols; run1++ )
+        seed( run1, color[run1] ) = 1.0;
+
+    return seed;
+}
+
+
+returnValue JacobianColoring::recover( const DMatrix &compressed, DMatrix &jacobian ) const{
+
+    int run1, run2;
+
+    if( (int) compressed.getNumRows() != nRows || (int) compressed.getNumCols() != nColors )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    jacobian = zeros<double>( nRows, nCols );
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+        for( run2 = 0; run2 < nColors; run2++ ){
+            const int col = rowColumn[run1*nColors+run2];
+            if( col >= 0 ) jacobian( run1, col ) = compressed( run1, run2 );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,143 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/jacobian_coloring.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#ifndef ACADO_TOOLKIT_JACOBIAN_COLORING_HPP
+#define ACADO_TOOLKIT_JACOBIAN_COLORING_HPP
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Column coloring of a sparse Jacobian for compressed AD seeds.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class JacobianColoring partitions the columns of a Jacobian with
+ *  given sparsity pattern into groups (colors) of structurally orthogonal
+ *  columns, i.e. columns that have no nonzero entry in a common row. All
+ *  columns of one color can be obtained by a single forward derivative
+ *  whose seed is the sum of their unit vectors: every entry of the result
+ *  belongs to at most one of these columns. The coloring of the transposed
+ *  pattern compresses the rows, i.e. the backward seeds, in the same way.
+ *
+ *  The colors are assigned greedily in the order of decreasing number of
+ *  nonzeros per column. A dense pattern yields one color per column.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+class JacobianColoring{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    JacobianColoring( );
+
+    /** Constructor which colors the given sparsity pattern. */
+    JacobianColoring( const DMatrix &pattern /**< sparsity pattern, nonzero entries mark dependencies */ );
+
+    /** Destructor. */
+    ~JacobianColoring( );
+
+
+    /** Colors the columns of the given sparsity pattern.  \n
+     *                                                     \n
+     *  \return SUCCESSFUL_RETURN                          \n
+     */
+    returnValue init( const DMatrix &pattern /**< sparsity pattern, nonzero entries mark dependencies */ );
+
+
+    /** Returns the number of rows of the pattern. */
+    inline int getNumRows( ) const;
+
+    /** Returns the number of columns of the pattern. */
+    inline int getNumCols( ) const;
+
+    /** Returns the number of colors. */
+    inline int getNumberOfColors( ) const;
+
+    /** Returns the color of a column. */
+    inline int getColor( int col ) const;
+
+    /** Returns the column of the given color that has a nonzero entry \n
+     *  in the given row, or -1 if there is no such column.            \n
+     */
+    inline int getColumn( int row, int color ) const;
+
+    /** Returns whether the coloring compresses the columns, i.e. \n
+     *  whether it needs less colors than columns.                \n
+     */
+    inline BooleanType isCompressing( ) const;
+
+
+    /** Returns the (nCols x nColors) matrix of compressed seeds. */
+    DMatrix getSeedMatrix( ) const;
+
+    /** Recovers the Jacobian from the products with the seed matrix. \n
+     *                                                                \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                         \n
+     */
+    returnValue recover( const DMatrix &compressed /**< (nRows x nColors) Jacobian times seed matrix */,
+                         DMatrix       &jacobian   /**< the recovered (nRows x nCols) Jacobian        */ ) const;
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    int                nRows;        /**< Number of rows of the pattern.                       */
+    int                nCols;        /**< Number of columns of the pattern.                    */
+    int                nColors;      /**< Number of colors.                                    */
+
+    std::vector< int > color;        /**< Color of each column.                                */
+    std::vector< int > rowColumn;    /**< Column with a nonzero entry for each row and color.  */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/function/jacobian_coloring.ipp>
+
+
+#endif  // ACADO_TOOLKIT_JACOBIAN_COLORING_HPP
+
+// end of file.
@@ -0,0 +1,82 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+*    \file include/acado/function/jacobian_coloring.ipp
+*    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+*/
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+inline int JacobianColoring::getNumRows( ) const{
+
+    return nRows;
+}
+
+
+inline int JacobianColoring::getNumCols( ) const{
+
+    return nCols;
+}
+
+
+inline int JacobianColoring::getNumberOfColors( ) const{
+
+    return nColors;
+}
+
+
+inline int JacobianColoring::getColor( int col ) const{
+
+    ASSERT( col >= 0 && col < nCols );
+    return color[col];
+}
+
+
+inline int JacobianColoring::getColumn( int row, int color_ ) const{
+
+    ASSERT( row    >= 0 && row    < nRows   );
+    ASSERT( color_ >= 0 && color_ < nColors );
+    return rowColumn[row*nColors+color_];
+}
+
+
+inline BooleanType JacobianColoring::isCompressing( ) const{
+
+    if( nColors < nCols ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -575,6 +575,9 @@ returnValue Integrator::setupOptions( )
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_UPDATE_CONVERGENCE_RATE, defaultJacobianUpdateConvergenceRate );
+	addOption( JACOBIAN_UPDATE_STEPSIZE_RATIO  , defaultJacobianUpdateStepsizeRatio   );
+	addOption( JACOBIAN_UPDATE_MAX_STEPS       , defaultJacobianUpdateMaxSteps        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
@@ -608,6 +611,8 @@ returnValue Integrator::setupLogging( ){
     tmp.addItem( LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS,         "TIME FOR RHS EVALUATIONS         [sec]:  ");
     tmp.addItem( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,      "TIME FOR JACOBIAN EVALUATIONS    [sec]:  ");
     tmp.addItem( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,   "TIME FOR JACOBIAN DECOMPOSITIONS [sec]:  ");
+    tmp.addItem( LOG_NUMBER_OF_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITIONS,"NUMBER OF JACOBIAN DECOMPOSITIONS     :  ");
+    tmp.addItem( LOG_NUMBER_OF_BDF_INTEGRATOR_NEWTON_ITERATIONS,   "NUMBER OF NEWTON ITERATIONS           :  ");
 
     outputLoggingIdx = addLogRecord( tmp );
 
@@ -36,6 +36,7 @@
 #include <acado/symbolic_expression/symbolic_expression.hpp>
 #include <acado/function/function_.hpp>
 #include <acado/integrator/integrator.hpp>
+#include <acado/bindings/acado_csparse/acado_csparse.hpp>
 
 using namespace std;
 
@@ -328,6 +329,8 @@ void IntegratorBDF::allocateMemory( ){
         disturbance_index[run1] = rhs->index( VT_DISTURBANCE, run1 );
     }
 
+    initializeJacobianColoring();
+
     time_index = rhs->index( VT_TIME, 0 );
 
 
@@ -438,8 +441,16 @@ void IntegratorBDF::initializeVariables(){
 
     maxAlloc = 0;
 
-    nFcnEvaluations = 0;
-    nJacEvaluations = 0;
+    nFcnEvaluations    = 0;
+    nJacEvaluations    = 0;
+    nJacDecompositions = 0;
+    nNewtonIterations  = 0;
+
+    jacUpdateRate     = defaultJacobianUpdateConvergenceRate;
+    jacUpdateRatio    = defaultJacobianUpdateStepsizeRatio;
+    jacUpdateMaxSteps = defaultJacobianUpdateMaxSteps;
+    jacGamma          = 0.0;
+    nStepsSinceJac    = 0;
 }
 
 
@@ -671,6 +682,8 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
         disturbance_index[run1] = rhs->index( VT_DISTURBANCE, run1 );
     }
 
+    initializeJacobianColoring();
+
     time_index = rhs->index( VT_TIME, 0 );
 
 
@@ -784,8 +797,16 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
     // --------
     maxAlloc = 1;
 
-    nFcnEvaluations = 0;
-    nJacEvaluations = 0;
+    nFcnEvaluations    = 0;
+    nJacEvaluations    = 0;
+    nJacDecompositions = 0;
+    nNewtonIterations  = 0;
+
+    jacUpdateRate     = defaultJacobianUpdateConvergenceRate;
+    jacUpdateRatio    = defaultJacobianUpdateStepsizeRatio;
+    jacUpdateMaxSteps = defaultJacobianUpdateMaxSteps;
+    jacGamma          = 0.0;
+    nStepsSinceJac    = 0;
 }
 
 
@@ -926,6 +947,13 @@ void IntegratorBDF::deleteAll(){
         free(M_index);
     }
 
+    for( run1 = 0; run1 < (int) sparseLU.size(); run1++ ){
+         if( sparseLU[run1] != 0 )
+             delete sparseLU[run1];
+    }
+    sparseLU.clear();
+    qr.clear();
+
     if( F != NULL )
         delete[] F;
     if( F2 != NULL )
@@ -1212,8 +1240,14 @@ returnValue IntegratorBDF::evaluate( const DVector &x0  ,
      // ---------------------------
 
         totalTime.start();
-        nFcnEvaluations = 0;
-        nJacEvaluations = 0;
+        nFcnEvaluations    = 0;
+        nJacEvaluations    = 0;
+        nJacDecompositions = 0;
+        nNewtonIterations  = 0;
+
+        get( JACOBIAN_UPDATE_CONVERGENCE_RATE, jacUpdateRate     );
+        get( JACOBIAN_UPDATE_STEPSIZE_RATIO  , jacUpdateRatio    );
+        get( JACOBIAN_UPDATE_MAX_STEPS       , jacUpdateMaxSteps );
 
 
      // initialize the scaling based on the initial states:
@@ -1311,6 +1345,8 @@ returnValue IntegratorBDF::evaluate( const DVector &x0  ,
        setLast( LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS         , functionEvaluation.getTime()  );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION      , jacComputation.getTime()      );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION   , jacDecomposition.getTime()    );
+       setLast( LOG_NUMBER_OF_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITIONS, nJacDecompositions         );
+       setLast( LOG_NUMBER_OF_BDF_INTEGRATOR_NEWTON_ITERATIONS   , nNewtonIterations             );
 
     // ----------------------------------------------------------------------------------------
 
@@ -2354,6 +2390,19 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
 
     if( soa != SOA_MESH_FROZEN && soa != SOA_EVERYTHING_FROZEN ){
         COMPUTE_JACOBIAN = ini;
+
+        // RE-EVALUATE THE JACOBIAN IF THE BDF COEFFICIENT (I.E. THE
+        // STEPSIZE) HAS CHANGED TOO MUCH OR AFTER A MAXIMUM NUMBER OF
+        // STEPS, IF REQUESTED:
+        // ----------------------------------------------------------
+        if( jacUpdateRatio > 0.0 && jacGamma > 0.0 &&
+            fabs( gamma[stepnumber][4]/jacGamma - 1.0 ) > jacUpdateRatio )
+            COMPUTE_JACOBIAN = BT_TRUE;
+
+        if( jacUpdateMaxSteps > 0 && nStepsSinceJac >= jacUpdateMaxSteps )
+            COMPUTE_JACOBIAN = BT_TRUE;
+
+        nStepsSinceJac++;
     }
 
     if( soa != SOA_MESH_FROZEN && soa != SOA_EVERYTHING_FROZEN ){
@@ -2416,31 +2465,13 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = gamma[stepnumber][4];
-               iseed[ diff_index[run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
+           if( evaluateJacobian( 3*stepnumber+newtonsteps, 1.0, gamma[stepnumber][4],
+                                 *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN ){
+              return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
            }
 
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                        k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
-           }
+           jacGamma       = gamma[stepnumber][4];
+           nStepsSinceJac = 0;
 
            nJacEvaluations++;
            jacComputation.stop();
@@ -2455,6 +2486,9 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
            COMPUTE_JACOBIAN  = BT_FALSE;
        }
 
+       if( soa != SOA_MESH_FROZEN && soa != SOA_EVERYTHING_FROZEN )
+           nNewtonIterations++;
+
        norm1 = applyNewtonStep( M_index[stepnumber],
     		   	   	   	   	   	   eta[newtonsteps+1],
                                 eta[newtonsteps],
@@ -2479,7 +2513,7 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
            norm2 = norm1;
        }
 
-       if( newtonsteps == 1 && (norm1/norm2 > 0.33 || norm1/norm2 > sqrt(0.33*TOL/norm2)) ){
+       if( newtonsteps == 1 && (norm1/norm2 > jacUpdateRate || norm1/norm2 > sqrt(0.33*TOL/norm2)) ){
 
            if( JACOBIAN_COMPUTED == BT_FALSE ){
                COMPUTE_JACOBIAN = BT_TRUE;
@@ -2924,31 +2958,9 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = 1.0;
-               iseed[ diff_index[run1]] = ise;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
+           if( evaluateJacobian( 3*stepnumber+newtonsteps, ise, 1.0,
+                                 *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN ){
+              return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
            }
 
            nJacEvaluations++;
@@ -2964,6 +2976,9 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
            COMPUTE_JACOBIAN  = BT_FALSE;
        }
 
+       if( soa != SOA_MESH_FROZEN && soa != SOA_EVERYTHING_FROZEN )
+           nNewtonIterations++;
+
        norm1 = applyNewtonStep( M_index[stepnumber],
     		   	   	   	   	   k[newtonsteps+1][stepnumber],
                                 k[newtonsteps][stepnumber]  ,
@@ -2988,7 +3003,7 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
            norm2 = norm1;
        }
 
-       if( newtonsteps == 1 && (norm1/norm2 > 0.33 || norm1/norm2 > sqrt(0.33*TOL/norm2)) ){
+       if( newtonsteps == 1 && (norm1/norm2 > jacUpdateRate || norm1/norm2 > sqrt(0.33*TOL/norm2)) ){
 
            if( JACOBIAN_COMPUTED == BT_FALSE ){
                COMPUTE_JACOBIAN = BT_TRUE;
@@ -5113,21 +5128,44 @@ void IntegratorBDF::printRKIntermediateResults(){
 
 returnValue IntegratorBDF::decomposeJacobian(int index, DMatrix &J){
 
+    int run1;
+
 //	ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
 
     switch( las ){
 
         case HOUSEHOLDER_METHOD:
-//        	ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-        	break;
-//        	ASSERT( index < qr.size() );
-//        	qr[ index ] = Eigen::HouseholderQR< DMatrix::Base >( J );
-//        	return SUCCESSFUL_RETURN;
+
+             // THE DECOMPOSITION IS STORED FOR EACH STORAGE POSITION OF THE
+             // JACOBIAN AND REUSED BY ALL NEWTON STEPS AND SENSITIVITIES:
+             if( index >= (int) qr.size() )
+                 qr.resize( index+1 );
+
+             qr[index].compute( J );
+             nJacDecompositions++;
+             break;
 
         case SPARSE_LU:
-        		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-        		break;
-//             return J.computeSparseLUdecomposition();
+
+             // THE SPARSE SOLVERS ARE KEPT FOR EACH STORAGE POSITION OF THE
+             // JACOBIAN, SUCH THAT THE SYMBOLIC ANALYSIS IS ONLY DONE ONCE
+             // AND THE FACTORIZATION CAN BE REUSED (E.G. WHEN THE MESH IS
+             // FROZEN FOR THE SENSITIVITY COMPUTATION):
+             if( index >= (int) sparseLU.size() )
+                 sparseLU.resize( index+1, 0 );
+
+             if( sparseLU[index] == 0 ){
+                 sparseLU[index] = new ACADOcsparse();
+                 sparseLU[index]->setDimension( m );
+                 sparseLU[index]->setNumberOfEntries( (int) sparseRowIdx.size() );
+                 sparseLU[index]->setIndices( sparseRowIdx.data(), sparseColIdx.data() );
+             }
+
+             for( run1 = 0; run1 < (int) sparseRowIdx.size(); run1++ )
+                 sparseValues[run1] = J( sparseRowIdx[run1], sparseColIdx[run1] );
+
+             nJacDecompositions++;
+             return sparseLU[index]->setMatrix( sparseValues.data() );
 
         default:
              return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
@@ -5137,6 +5175,95 @@ returnValue IntegratorBDF::decomposeJacobian(int index, DMatrix &J){
 }
 
 
+void IntegratorBDF::initializeJacobianColoring(){
+
+    int run1, run2;
+
+    // THE COLUMN j < md OF THE JACOBIAN IS SEEDED IN THE DIRECTION OF
+    // THE DIFFERENTIAL STATE j AND ITS DERIVATIVE, THE COLUMN md+j IN
+    // THE DIRECTION OF THE ALGEBRAIC STATE j:
+    // ----------------------------------------------------------------
+    DVector    components = rhs->getDifferentialStateComponents();
+    Expression variables;
+
+    for( run1 = 0; run1 < md; run1++ )
+        variables.appendRows( Expression( "", 1, 1, VT_DIFFERENTIAL_STATE, (uint) components(run1) ) );
+    for( run1 = 0; run1 < md; run1++ )
+        variables.appendRows( Expression( "", 1, 1, VT_DDIFFERENTIAL_STATE, (uint) run1 ) );
+    for( run1 = 0; run1 < ma; run1++ )
+        variables.appendRows( Expression( "", 1, 1, VT_ALGEBRAIC_STATE, (uint) run1 ) );
+
+    DMatrix dependency = rhs->getDependencyPattern( variables );
+    DMatrix pattern    = zeros<double>( m, m );
+
+    for( run1 = 0; run1 < m && run1 < (int) dependency.getNumRows(); run1++ ){
+        for( run2 = 0; run2 < md; run2++ )
+            pattern(run1,run2) = dependency(run1,run2) + dependency(run1,md+run2);
+        for( run2 = 0; run2 < ma; run2++ )
+            pattern(run1,md+run2) = dependency(run1,2*md+run2);
+    }
+
+    jacColoring.init( pattern );
+
+    // THE NONZERO ENTRIES OF THE JACOBIAN (COLUMN BY COLUMN) FOR THE
+    // SPARSE LU DECOMPOSITION:
+    // ---------------------------------------------------------------
+    sparseRowIdx.clear();
+    sparseColIdx.clear();
+
+    for( run2 = 0; run2 < m; run2++ ){
+        for( run1 = 0; run1 < m; run1++ ){
+            if( jacColoring.getColumn( run1, jacColoring.getColor(run2) ) == run2 ){
+                sparseRowIdx.push_back( run1 );
+                sparseColIdx.push_back( run2 );
+            }
+        }
+    }
+    sparseValues.resize( sparseRowIdx.size() );
+}
+
+
+returnValue IntegratorBDF::evaluateJacobian( int number, double diffSeed, double ddiffSeed, DMatrix &J ){
+
+    int run1, run2, run3;
+
+    J.setZero();
+
+    for( run1 = 0; run1 < jacColoring.getNumberOfColors(); run1++ ){
+
+        for( run3 = 0; run3 < md; run3++ ){
+            if( jacColoring.getColor(run3) == run1 ){
+                iseed[ddiff_index[run3]] = ddiffSeed;
+                iseed[ diff_index[run3]] = diffSeed;
+            }
+        }
+        for( run3 = md; run3 < m; run3++ )
+            if( jacColoring.getColor(run3) == run1 )
+                iseed[diff_index[run3]] = 1.0;
+
+        if( rhs[0].AD_forward( number, iseed, k2[0][0] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+
+        for( run2 = 0; run2 < m; run2++ ){
+            run3 = jacColoring.getColumn( run2, run1 );
+            if( run3 >= 0 ) J(run2,run3) = k2[0][0][run2];
+        }
+
+        for( run3 = 0; run3 < md; run3++ ){
+            if( jacColoring.getColor(run3) == run1 ){
+                iseed[ddiff_index[run3]] = 0.0;
+                iseed[ diff_index[run3]] = 0.0;
+            }
+        }
+        for( run3 = md; run3 < m; run3++ )
+            if( jacColoring.getColor(run3) == run1 )
+                iseed[diff_index[run3]] = 0.0;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 double IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF ){
 
     int run1;
@@ -5146,12 +5273,13 @@ double IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const doubl
 	switch (las)
 	{
 	case HOUSEHOLDER_METHOD:
-		deltaX = J.householderQr().solve( bb );
-//		deltaX = qr[ index ].solve(bb);
+		deltaX = qr[ index ].solve( bb );
 		break;
 	case SPARSE_LU:
-		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-//		deltaX = J.solveSparseLU(bb);
+		deltaX = bb;
+		if ( index >= (int) sparseLU.size() || sparseLU[index] == 0 ||
+			 sparseLU[index]->solve( deltaX.data() ) != SUCCESSFUL_RETURN )
+			ACADOERROR( RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF );
 		break;
 	default:
 		deltaX.setZero();
@@ -5178,15 +5306,15 @@ void IntegratorBDF::applyMTranspose( int index, double *seed1, DMatrix &J, doubl
 	switch (las)
 	{
 	case HOUSEHOLDER_METHOD:
-		// Dodgy
-		deltaX = J.transpose().householderQr().solve( bb );
-//		deltaX = J.solveTransposeQR(bb);
-//		deltaX = qr[ index ].matrixQR().block(0, 0, J.cols(), J.cols()).
-//			triangularView<Eigen::Upper>().transpose().solve( bb );
+		// J^T = R^T Q^T, i.e. deltaX = Q R^{-T} bb:
+		deltaX = qr[ index ].householderQ()*
+				 qr[ index ].matrixQR().triangularView<Eigen::Upper>().transpose().solve( bb );
 		break;
 	case SPARSE_LU:
-		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-//		deltaX = J.solveTransposeSparseLU(bb);
+		deltaX = bb;
+		if ( index >= (int) sparseLU.size() || sparseLU[index] == 0 ||
+			 sparseLU[index]->solveTranspose( deltaX.data() ) != SUCCESSFUL_RETURN )
+			ACADOERROR( RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF );
 		break;
 	default:
 		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
@@ -383,6 +383,21 @@ protected:
     returnValue decomposeJacobian(int index, DMatrix &J );
 
 
+    /** Colors the columns of the Jacobian for Newton's method according \n
+     *  to the structural dependency pattern of the right-hand side.      \n
+     */
+    void initializeJacobianColoring();
+
+
+    /** Evaluates the Jacobian for Newton's method with one forward       \n
+     *  derivative per color of its columns; the differential states and  \n
+     *  their derivatives are seeded with the given weights.              \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF               \n
+     */
+    returnValue evaluateJacobian( int number, double diffSeed, double ddiffSeed, DMatrix &J );
+
+
     /** applies a newton step                                              \n
      *  \return the norm of the increment                                  \n
      */
@@ -547,10 +562,16 @@ protected:
                                   *   polynom.                                            */
 
     DMatrix **M                 ; /**< the Jacobians for Newton's method                   */
-//    std::vector< Eigen::HouseholderQR< DMatrix::Base > > qr;
+    std::vector< Eigen::HouseholderQR< DMatrix::Base > > qr; /**< QR decompositions of the Jacobians */
     int     *M_index           ; /**< the index of the inverse approximation              */
     int      nOfM              ; /**< number of distinct inverse Jacobian approximations  */
     int      maxNM             ; /**< number of allocated Jacobian storage positions      */
+    JacobianColoring jacColoring; /**< column coloring of the Jacobian for Newton's method */
+
+    std::vector< SparseSolver* > sparseLU; /**< sparse LU factorizations of the Jacobians   */
+    std::vector< int >    sparseRowIdx; /**< row indices of the nonzero Jacobian entries  */
+    std::vector< int >    sparseColIdx; /**< column indices of the nonzero Jacobian entries */
+    std::vector< double > sparseValues; /**< values of the nonzero Jacobian entries       */
 
     int     *nOfNewtonSteps    ; /**< the number of newton steps (for each BDF-step)      */
     double **eta               ; /**< the predictor and corrector approximations          */
@@ -637,6 +658,17 @@ protected:
     RealClock jacDecomposition  ;
     RealClock correctorTime     ;
     int       nJacEvaluations   ;
+    int       nJacDecompositions;
+    int       nNewtonIterations ;
+
+
+    // JACOBIAN UPDATE POLICY:
+    // -----------------------
+    double    jacUpdateRate     ;  /**< contraction rate triggering a Jacobian update      */
+    double    jacUpdateRatio    ;  /**< change of gamma triggering a Jacobian update       */
+    int       jacUpdateMaxSteps ;  /**< maximum number of steps between Jacobian updates   */
+    double    jacGamma          ;  /**< BDF coefficient of the last Jacobian evaluation    */
+    int       nStepsSinceJac    ;  /**< number of BDF steps since the last Jacobian update */
 
 };
 
@@ -866,6 +866,8 @@ returnValue IntegratorLYAPUNOV::evaluate( const DVector &x0  ,
        setLast( LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS         , functionEvaluation.getTime()  );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION      , 0.0                           );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION   , 0.0                           );
+       setLast( LOG_NUMBER_OF_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITIONS, 0                          );
+       setLast( LOG_NUMBER_OF_BDF_INTEGRATOR_NEWTON_ITERATIONS   , 0                             );
 
     // ----------------------------------------------------------------------------------------
 
@@ -322,7 +322,15 @@ returnValue MultiObjectiveAlgorithm::solve( ){
     totalNumberOfSQPiterations = 0;
     totalCPUtime               = -acadoGetTime();
 
+    int nThreads;
+    get( PARETO_FRONT_NUM_THREADS, nThreads );
+
     run1 = 0;
+    if( nThreads > 1 ){
+        solveConcurrently( Weights, arg, nThreads );
+        run1 = (int) Weights.getNumCols();   // all points are done
+    }
+
     while( run1 < (int) Weights.getNumCols() ){
 
 
@@ -339,11 +347,7 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 
         // THIS PART OF THE CODE WILL NOT RUN YET FOR GENERAL WEIGHTS
 
-        int vertex = -1;
-        for( run2 = 0; run2 < m; run2++ ){
-            if( fabs( idx[run2]-1.0 ) < 100.0*EPS )
-                vertex = run2;
-        }
+        int vertex = getVertex( Weights, run1 );
         // ----------------------------------------------------------
 
 
@@ -415,11 +419,204 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+returnValue MultiObjectiveAlgorithm::solveConcurrently( const DMatrix     &Weights ,
+                                                        Expression       **arg     ,
+                                                        int                nThreads  ){
+
+    int run1, run2, run3;
+
+    int nPoints = (int) Weights.getNumCols();
+
+    int paretoGeneration;
+    get( PARETO_FRONT_GENERATION, paretoGeneration );
+
+    int hotstart;
+    get( PARETO_FRONT_HOTSTART, hotstart );
+
+    threadPool.init( nThreads );
+
+    Constraint tmp_con;
+    double *idx = new double[m];
+
+
+    // THE VERTICES OF THE SIMPLEX ARE SOLVED IF solveSingleObjective HAS BEEN CALLED:
+    // -------------------------------------------------------------------------------
+    std::vector< BooleanType > isSolved( nPoints, BT_FALSE );
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        int vertex = getVertex( Weights, run1 );
+        if( vertex != -1 && vertices.getDim() != 0 && vertices(vertex,vertex) > -INFTY )
+            isSolved[run1] = BT_TRUE;
+    }
+
+
+    // THE VERTICES ARE SOLVED FIRST, AS THEY INITIALIZE THE INNER POINTS:
+    // --------------------------------------------------------------------
+    std::vector< int > order;
+
+    if( paretoGeneration == PFG_WEIGHTED_SUM ){
+        for( run1 = 0; run1 < nPoints; run1++ )
+            if( getVertex( Weights, run1 ) != -1 )
+                order.push_back( run1 );
+    }
+    for( run1 = 0; run1 < nPoints; run1++ )
+        if( getVertex( Weights, run1 ) == -1 )
+            order.push_back( run1 );
+
+
+    std::vector< BooleanType > isNewlySolved( nPoints, BT_FALSE );
+
+    for( run1 = 0; run1 < (int) order.size(); run1 += nThreads ){
+
+        int nWave = acadoMin( nThreads, (int) order.size() - run1 );
+
+
+        // SET UP ONE ALGORITHM PER POINT (THE SYMBOLIC LAYER IS NOT THREAD-SAFE):
+        // ----------------------------------------------------------------------
+        std::vector< MultiObjectiveAlgorithm* > workers( nWave );
+        std::vector< returnValue > returnvalues( nWave );
+
+        for( run2 = 0; run2 < nWave; run2++ ){
+
+            int point = order[run1+run2];
+
+            printf("\n\n Multi-objective point: %d out of %d \n\n",point+1, nPoints );
+
+            for( run3 = 0; run3 < m; run3++ )
+                idx[run3] = Weights( run3, point );
+
+            ocp->getConstraint( tmp_con );
+            formulateOCP( idx, ocp, arg );
+            workers[run2] = new MultiObjectiveAlgorithm( *ocp );
+            ocp->setConstraint( tmp_con );
+
+            workers[run2]->setOptions( *this );
+            if( run2 > 0 )
+                workers[run2]->set( PRINT_COPYRIGHT, BT_FALSE );
+
+            int neighbour = getNearestSolvedPoint( Weights, isSolved, point );
+
+            if( hotstart == BT_TRUE && neighbour != -1 ){
+                *workers[run2]->userInit.x  = xResults [neighbour];
+                *workers[run2]->userInit.xa = xaResults[neighbour];
+                *workers[run2]->userInit.p  = pResults [neighbour];
+                *workers[run2]->userInit.u  = uResults [neighbour];
+                *workers[run2]->userInit.w  = wResults [neighbour];
+            }
+            else{
+                workers[run2]->userInit = userInit;
+            }
+
+            returnvalues[run2] = workers[run2]->init( );
+        }
+        set( PRINT_COPYRIGHT, BT_FALSE );
+
+
+        // SOLVE THE NLPs CONCURRENTLY:
+        // ----------------------------
+        threadPool.run( nWave, [&]( int i ){
+            if( returnvalues[i] == SUCCESSFUL_RETURN )
+                returnvalues[i] = workers[i]->OptimizationAlgorithm::solve( );
+        });
+
+
+        // STORE THE SOLUTIONS:
+        // --------------------
+        for( run2 = 0; run2 < nWave; run2++ ){
+
+            int point = order[run1+run2];
+
+            if( workers[run2]->nlpSolver != 0 )
+                totalNumberOfSQPiterations += workers[run2]->nlpSolver->getNumberOfSteps();
+
+            if( returnvalues[run2] != SUCCESSFUL_RETURN ){
+                ACADOERROR(returnvalues[run2]);
+            }
+            else{
+                workers[run2]->getDifferentialStates( xResults[point]  );
+                workers[run2]->getAlgebraicStates   ( xaResults[point] );
+                workers[run2]->getParameters        ( pResults[point]  );
+                workers[run2]->getControls          ( uResults[point]  );
+                workers[run2]->getDisturbances      ( wResults[point]  );
+
+                isSolved[point]      = BT_TRUE;
+                isNewlySolved[point] = BT_TRUE;
+            }
+            delete workers[run2];
+        }
+    }
+
+
+    // EVALUATE THE OBJECTIVES IN THE ORDER OF THE WEIGHTS:
+    // ----------------------------------------------------
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        int vertex = getVertex( Weights, run1 );
+
+        if( isNewlySolved[run1] == BT_TRUE ){
+            evaluateObjectives( xResults[run1], xaResults[run1], pResults[run1], uResults[run1], wResults[run1], arg );
+        }
+        else if( vertex != -1 && paretoGeneration != PFG_WEIGHTED_SUM ){
+            printf(" Result from single objective optimization is adopted. \n\n" );
+            for( run2 = 0; run2 < m; run2++ ){
+                result(count,run2) = vertices(vertex,run2);
+            }
+            count++;
+        }
+    }
+
+    delete[] idx;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+int MultiObjectiveAlgorithm::getVertex( const DMatrix &Weights, int point ) const{
+
+    int run1;
+    int vertex = -1;
+
+    for( run1 = 0; run1 < m; run1++ ){
+        if( fabs( Weights(run1,point)-1.0 ) < 100.0*EPS )
+            vertex = run1;
+    }
+    return vertex;
+}
+
+
+int MultiObjectiveAlgorithm::getNearestSolvedPoint( const DMatrix                    &Weights ,
+                                                    const std::vector< BooleanType > &isSolved,
+                                                    int                               point     ) const{
+
+    int run1, run2;
+    int    nearest  = -1;
+    double distance = INFTY;
+
+    for( run1 = 0; run1 < (int) Weights.getNumCols(); run1++ ){
+
+        if( isSolved[run1] == BT_FALSE )
+            continue;
+
+        double tmp = 0.0;
+        for( run2 = 0; run2 < m; run2++ )
+            tmp += ( Weights(run2,run1)-Weights(run2,point) )*( Weights(run2,run1)-Weights(run2,point) );
+
+        if( tmp < distance ){
+            distance = tmp;
+            nearest  = run1;
+        }
+    }
+    return nearest;
+}
+
+
 returnValue MultiObjectiveAlgorithm::setupOptions( )
 {
     addOption( PARETO_FRONT_DISCRETIZATION  , defaultParetoFrontDiscretization );
     addOption( PARETO_FRONT_GENERATION      , defaultParetoFrontGeneration     );
     addOption( PARETO_FRONT_HOTSTART        , defaultParetoFrontHotstart       );
+    addOption( PARETO_FRONT_NUM_THREADS     , defaultParetoFrontNumThreads     );
 
 	// add optimization algorithm options
 	//OptimizationAlgorithm::setupOptions( );
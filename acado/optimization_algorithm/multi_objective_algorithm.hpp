@@ -36,6 +36,7 @@
 
 #include <acado/optimization_algorithm/optimization_algorithm.hpp>
 #include <acado/optimization_algorithm/weight_generation.hpp>
+#include <acado/utils/acado_thread_pool.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -247,6 +248,35 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
 
 
 
+        /** Solves the subproblems for all weights, distributing them  \n
+         *  over the given number of threads. The points are solved in \n
+         *  waves of nThreads each, starting with the vertices of the  \n
+         *  simplex; every point gets its own copy of the OCP and NLP  \n
+         *  solver and, if PARETO_FRONT_HOTSTART is set, is initialized \n
+         *  with the solution of the nearest point (in the weight space) \n
+         *  solved in a previous wave.                                  \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         */
+        returnValue solveConcurrently( const DMatrix     &Weights ,
+                                       Expression       **arg     ,
+                                       int                nThreads  );
+
+
+        /** Returns the index of the objective whose weight is one for  \n
+         *  the given point, or -1 if the point is no vertex.           \n
+         */
+        int getVertex( const DMatrix &Weights, int point ) const;
+
+
+        /** Returns the solved point which is closest to the given point \n
+         *  in the weight space, or -1 if no point has been solved yet.  \n
+         */
+        int getNearestSolvedPoint( const DMatrix                    &Weights ,
+                                   const std::vector< BooleanType > &isSolved,
+                                   int                               point     ) const;
+
+
         inline returnValue printAuxiliaryRoutine( const char*fileName, VariablesGrid *x_ ) const;
 
 
@@ -270,6 +300,8 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
         VariablesGrid *uResults    ;
         VariablesGrid *wResults    ;
 
+        ThreadPool     threadPool  ;   // threads solving the points concurrently
+
 
      private:
 
@@ -513,6 +513,7 @@ returnValue RealTimeAlgorithm::setupOptions( )
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( NUM_INTEGRATOR_THREADS      , defaultNumIntegratorThreads    );
 	addOption( INTEGRATOR_TYPE             , defaultIntegratorType          );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
@@ -528,6 +529,9 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_UPDATE_CONVERGENCE_RATE, defaultJacobianUpdateConvergenceRate );
+	addOption( JACOBIAN_UPDATE_STEPSIZE_RATIO  , defaultJacobianUpdateStepsizeRatio   );
+	addOption( JACOBIAN_UPDATE_MAX_STEPS       , defaultJacobianUpdateMaxSteps        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
@@ -129,9 +129,24 @@ Expression multipleForwardDerivative( const Expression &arg1,
                               const Expression &arg2,
                               const Expression &seed  ){
 
+	// the Jacobian is evaluated with compressed seeds (see Expression::ADforward)
+	// and multiplied with the seed matrix, where only its nonzero entries are used:
+	const Expression jac = forwardDerivative( arg1, arg2 );
+
+	DMatrix jacPattern  = jac .getSparsityPattern();
+	DMatrix seedPattern = seed.getSparsityPattern();
+
 	Expression tmp;
-	for( uint i = 0; i < seed.getNumCols(); i++ ) {
-		tmp.appendCols( forwardDerivative( arg1, arg2, seed.getCol(i) ) );
+	for( uint j = 0; j < seed.getNumCols(); j++ ) {
+		Expression col;
+		for( uint i = 0; i < jac.getNumRows(); i++ ) {
+			Expression sum( "", 1u, 1u );
+			for( uint k = 0; k < jac.getNumCols(); k++ )
+				if( jacPattern(i,k) != 0.0 && seedPattern(k,j) != 0.0 )
+					sum = sum + jac(i,k)*seed(k,j);
+			col.appendRows( sum );
+		}
+		tmp.appendCols( col );
 	}
     return tmp;
 }
@@ -91,7 +91,7 @@ Expression::Expression( const double& rhs )
 {
 	construct(VT_UNKNOWN, 0, 1, 1, "");
 	delete element[ 0 ];
-	element[ 0 ] = new DoubleConstant(rhs, NE_NEITHER_ONE_NOR_ZERO);
+	element[ 0 ] = OperatorStore::getConstant(rhs, NE_NEITHER_ONE_NOR_ZERO);
 }
 
 Expression::Expression( const DVector& rhs )
@@ -100,7 +100,7 @@ Expression::Expression( const DVector& rhs )
 	for(unsigned el = 0; el < rhs.getDim(); el++ )
 	{
 		delete element[ el ];
-		element[ el ] = new DoubleConstant(rhs( el ), NE_NEITHER_ONE_NOR_ZERO);
+		element[ el ] = OperatorStore::getConstant(rhs( el ), NE_NEITHER_ONE_NOR_ZERO);
 	}
 }
 
@@ -113,7 +113,7 @@ Expression::Expression( const DMatrix& rhs )
 		{
 			delete element[rhs.getNumCols() * run1 + run2];
 			element[rhs.getNumCols() * run1 + run2] = 
-				new DoubleConstant(rhs(run1, run2), NE_NEITHER_ONE_NOR_ZERO);
+				OperatorStore::getConstant(rhs(run1, run2), NE_NEITHER_ONE_NOR_ZERO);
 		}
 	}
 }
@@ -152,7 +152,7 @@ Expression&  Expression::appendRows(const Expression& arg) {
 	element = (Operator**)realloc(element, dim*sizeof(Operator*) );
 	    
 	for( run1 = oldDim; run1 < dim; run1++ )
-		element[run1] = arg.element[run1-oldDim]->clone();
+		element[run1] = arg.element[run1-oldDim]->share();
 	
 	return *this;
 }
@@ -189,7 +189,7 @@ Expression& Expression::operator<<( const Expression& arg ){
     element = (Operator**)realloc(element, dim*sizeof(Operator*) );
 
     for( run1 = oldDim; run1 < dim; run1++ )
-        element[run1] = arg.element[run1-oldDim]->clone();
+        element[run1] = arg.element[run1-oldDim]->share();
 
     return *this;
 }
@@ -222,7 +222,7 @@ Expression Expression::operator()( uint idx ) const{
     Expression tmp(1);
 
     delete tmp.element[0];
-    tmp.element[0] = element[idx]->clone();
+    tmp.element[0] = element[idx]->share();
 
     tmp.component    = component + idx;
     tmp.variableType = variableType;
@@ -238,7 +238,7 @@ Expression Expression::operator()( uint rowIdx, uint colIdx ) const{
     Expression tmp(1);
 
     delete tmp.element[0];
-    tmp.element[0] = element[rowIdx*getNumCols()+colIdx]->clone();
+    tmp.element[0] = element[rowIdx*getNumCols()+colIdx]->share();
 
     tmp.component    = component + rowIdx*getNumCols() + colIdx;
     tmp.variableType = variableType;
@@ -253,16 +253,18 @@ Operator& Expression::operator()( uint idx ){
 
         case  VT_INTERMEDIATE_STATE:
               ASSERT( idx < getDim( ) );
+              detachElement( idx );
               return *element[idx];
 
         case VT_UNKNOWN:
               ASSERT( idx < getDim( ) );
-              delete  element[idx];
+              Operator::release( element[idx] );
               element[idx] = new TreeProjection();
               return *element[idx];
 
         default:
               ASSERT( idx < getDim( ) );
+              detachElement( idx );
               return *element[idx];
     }
     ASSERT( 1 == 0 );
@@ -277,13 +279,14 @@ Operator& Expression::operator()( uint rowIdx, uint colIdx ){
         case  VT_INTERMEDIATE_STATE:
               ASSERT( rowIdx < getNumRows( ) );
               ASSERT( colIdx < getNumCols( ) );
+              detachElement( rowIdx*getNumCols()+colIdx );
               return *element[rowIdx*getNumCols()+colIdx];
 
 //        case  VT_UNKNOWN:
         default:
               ASSERT( rowIdx < getNumRows( ) );
               ASSERT( colIdx < getNumCols( ) );
-              delete  element[rowIdx*getNumCols()+colIdx];
+              Operator::release( element[rowIdx*getNumCols()+colIdx] );
               element[rowIdx*getNumCols()+colIdx] = new TreeProjection();
               return *element[rowIdx*getNumCols()+colIdx];
 
@@ -331,14 +334,15 @@ Expression Expression::add( const Expression& arg ) const{
             delete tmp.element[i*getNumCols()+j];
             if( element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO ){
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                    tmp.element[i*getNumCols()+j] = new Addition( element[i*getNumCols()+j]->clone(),
-                                                    arg.element[i*getNumCols()+j]->clone() );
+                    tmp.element[i*getNumCols()+j] = OperatorStore::getBinary( ON_ADDITION,
+                                                    element[i*getNumCols()+j]->share(),
+                                                    arg.element[i*getNumCols()+j]->share() );
                 else
-                    tmp.element[i*getNumCols()+j] = element[i*getNumCols()+j]->clone();
+                    tmp.element[i*getNumCols()+j] = element[i*getNumCols()+j]->share();
             }
             else{
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                     tmp.element[i*getNumCols()+j] = arg.element[i*getNumCols()+j]->clone();
+                     tmp.element[i*getNumCols()+j] = arg.element[i*getNumCols()+j]->share();
                 else tmp.element[i*getNumCols()+j] = new DoubleConstant(0.0,NE_ZERO);
             }
         }
@@ -362,15 +366,17 @@ Expression Expression::sub( const Expression& arg ) const{
             delete tmp.element[i*getNumCols()+j];
             if( element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO ){
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                    tmp.element[i*getNumCols()+j] = new Subtraction( element[i*getNumCols()+j]->clone(),
-                                                    arg.element[i*getNumCols()+j]->clone() );
+                    tmp.element[i*getNumCols()+j] = OperatorStore::getBinary( ON_SUBTRACTION,
+                                                    element[i*getNumCols()+j]->share(),
+                                                    arg.element[i*getNumCols()+j]->share() );
                 else
-                    tmp.element[i*getNumCols()+j] = element[i*getNumCols()+j]->clone();
+                    tmp.element[i*getNumCols()+j] = element[i*getNumCols()+j]->share();
             }
             else{
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                     tmp.element[i*getNumCols()+j] = new Subtraction( new DoubleConstant(0.0,NE_ZERO),
-                                                                      arg.element[i*getNumCols()+j]->clone() );
+                     tmp.element[i*getNumCols()+j] = OperatorStore::getBinary( ON_SUBTRACTION,
+                                                                      OperatorStore::getConstant(0.0,NE_ZERO),
+                                                                      arg.element[i*getNumCols()+j]->share() );
                 else tmp.element[i*getNumCols()+j] = new DoubleConstant(0.0,NE_ZERO);
             }
         }
@@ -379,7 +385,7 @@ Expression Expression::sub( const Expression& arg ) const{
 }
 
 
-Operator* Expression::product( const Operator *a, const Operator *b ) const{
+Operator* Expression::product( Operator *a, Operator *b ) const{
 
 
     switch( a->isOneOrZero() ){
@@ -388,7 +394,7 @@ Operator* Expression::product( const Operator *a, const Operator *b ) const{
              return new DoubleConstant( 0.0, NE_ZERO );
 
         case NE_ONE:
-             return b->clone();
+             return b->share();
 
         default:
 
@@ -398,10 +404,10 @@ Operator* Expression::product( const Operator *a, const Operator *b ) const{
                       return new DoubleConstant( 0.0, NE_ZERO );
 
                  case NE_ONE:
-                      return a->clone();
+                      return a->share();
 
                  default:
-                      return new Product( a->clone(), b->clone() );
+                      return OperatorStore::getBinary( ON_PRODUCT, a->share(), b->share() );
              }
     }
     return 0;
@@ -422,10 +428,7 @@ Expression Expression::mul( const Expression& arg ) const{
         for( i = 0; i< arg.getDim(); i++ ){
 
              delete tmp.element[i];
-             Operator *prod = product( element[0], arg.element[i] );
-             tmp.element[i] = prod->clone();
-
-             delete prod;
+             tmp.element[i] = product( element[0], arg.element[i] );
         }
         return tmp;
     }
@@ -438,10 +441,7 @@ Expression Expression::mul( const Expression& arg ) const{
         for( i = 0; i< getDim(); i++ ){
 
              delete tmp.element[i];
-             Operator *prod = product( arg.element[0], element[i] );
-             tmp.element[i] = prod->clone();
-
-             delete prod;
+             tmp.element[i] = product( arg.element[0], element[i] );
         }
         return tmp;
     }
@@ -463,7 +463,7 @@ Expression Expression::mul( const Expression& arg ) const{
                  if( tmpO->isOneOrZero() != NE_ZERO )
                      tmp(i,j) += *tmpO;
 
-                 delete tmpO;
+                 Operator::release( tmpO );
             }
         }
     }
@@ -482,7 +482,7 @@ Expression Expression::div( const Expression& arg ) const{
 
     for( i = 0; i< getDim(); i++ ){
          delete tmp.element[i];
-         tmp.element[i] = new Quotient( element[i]->clone(), arg.element[0]->clone() );
+         tmp.element[i] = OperatorStore::getBinary( ON_QUOTIENT, element[i]->share(), arg.element[0]->share() );
     }
     return tmp;
 }
@@ -522,7 +522,7 @@ Expression Expression::getInverse() const{
     for( i = 0; i < M; i++ ){
         for( j = 0; j < M; j++ ){
             delete I.element[i*M+j];
-            I.element[i*M+j] = tmp.element[i*2*M+j+M]->clone();
+            I.element[i*M+j] = tmp.element[i*2*M+j+M]->share();
         }
     }
 
@@ -539,7 +539,7 @@ Expression Expression::getRow( const uint& rowIdx ) const{
 
     for( run1 = 0; run1 < getNumCols(); run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = element[rowIdx*getNumCols()+run1]->clone();
+        tmp.element[run1] = element[rowIdx*getNumCols()+run1]->share();
     }
     return tmp;
 }
@@ -557,7 +557,7 @@ Expression Expression::getRows( const uint& rowIdx1, const uint& rowIdx2 ) const
     for( run1 = 0; run1 < _nRows; run1++ ){
     	for( run2 = 0; run2 < getNumCols(); run2++ ){
     		delete tmp.element[run1*getNumCols()+run2];
-    		tmp.element[run1*getNumCols()+run2] = element[(rowIdx1+run1)*getNumCols()+run2]->clone();
+    		tmp.element[run1*getNumCols()+run2] = element[(rowIdx1+run1)*getNumCols()+run2]->share();
     	}
     }
     return tmp;
@@ -573,7 +573,7 @@ Expression Expression::getCol( const uint& colIdx ) const{
 
     for( run1 = 0; run1 < getNumRows(); run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = element[run1*getNumCols()+colIdx]->clone();
+        tmp.element[run1] = element[run1*getNumCols()+colIdx]->share();
     }
     return tmp;
 }
@@ -591,7 +591,7 @@ Expression Expression::getCols( const uint& colIdx1, const uint& colIdx2 ) const
     for( run1 = 0; run1 < getNumRows(); run1++ ){
     	for( run2 = 0; run2 < _nCols; run2++ ){
     		delete tmp.element[run1*_nCols+run2];
-    		tmp.element[run1*_nCols+run2] = element[run1*getNumCols()+colIdx1+run2]->clone();
+    		tmp.element[run1*_nCols+run2] = element[run1*getNumCols()+colIdx1+run2]->share();
     	}
     }
     return tmp;
@@ -613,7 +613,7 @@ Expression Expression::getSubMatrix( const uint& rowIdx1, const uint& rowIdx2, c
     for( run1 = 0; run1 < _nRows; run1++ ){
     	for( run2 = 0; run2 < _nCols; run2++ ){
     		delete tmp.element[run1*_nCols+run2];
-    		tmp.element[run1*_nCols+run2] = element[(rowIdx1+run1)*getNumCols()+colIdx1+run2]->clone();
+    		tmp.element[run1*_nCols+run2] = element[(rowIdx1+run1)*getNumCols()+colIdx1+run2]->share();
     	}
     }
     return tmp;
@@ -653,17 +653,24 @@ DMatrix Expression::getDependencyPattern( const Expression& arg ) const{
     return tmp;
 }
 
+DMatrix Expression::getJacobianSparsityPattern( const Expression& arg ) const{
+
+	if( getDim() == 0 || arg.getDim() == 0 )
+		return zeros<double>( getDim(), arg.getDim() );
+
+	Function f;
+	f << *this;
+
+	return f.getDependencyPattern( arg );
+}
+
 DMatrix Expression::getSparsityPattern() const
 {
 	DMatrix res = zeros<double>(getNumRows(), getNumCols());
 
 	for (unsigned el = 0; el < getDim(); ++el)
-	{
-		Operator* foo = getOperatorClone(el);
-		if (foo->isOneOrZero() != NE_ZERO)
+		if (element[el]->isOneOrZero() != NE_ZERO)
 			res(el) = 1.0;
-		delete foo;
-	}
 
 	return res;
 }
@@ -677,7 +684,7 @@ Expression Expression::getSin( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Sin( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_SIN, element[run1]->share() );
     }
     return tmp;
 }
@@ -689,7 +696,7 @@ Expression Expression::getCos( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Cos( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_COS, element[run1]->share() );
     }
     return tmp;
 }
@@ -701,7 +708,7 @@ Expression Expression::getTan( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Tan( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_TAN, element[run1]->share() );
     }
     return tmp;
 }
@@ -713,7 +720,7 @@ Expression Expression::getAsin( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Asin( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_ASIN, element[run1]->share() );
     }
     return tmp;
 }
@@ -725,7 +732,7 @@ Expression Expression::getAcos( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Acos( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_ACOS, element[run1]->share() );
     }
     return tmp;
 }
@@ -737,7 +744,7 @@ Expression Expression::getAtan( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Atan( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_ATAN, element[run1]->share() );
     }
     return tmp;
 }
@@ -749,7 +756,7 @@ Expression Expression::getExp( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Exp( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_EXP, element[run1]->share() );
     }
     return tmp;
 }
@@ -761,7 +768,8 @@ Expression Expression::getSqrt( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Power( element[run1]->clone(), new DoubleConstant( 0.5, NE_NEITHER_ONE_NOR_ZERO ) ); 
+        tmp.element[run1] = OperatorStore::getBinary( ON_POWER, element[run1]->share(),
+                                                      OperatorStore::getConstant( 0.5, NE_NEITHER_ONE_NOR_ZERO ) );
     }
     return tmp;
 }
@@ -773,7 +781,7 @@ Expression Expression::getLn( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Logarithm( element[run1]->clone() ); 
+        tmp.element[run1] = OperatorStore::getUnary( ON_LOGARITHM, element[run1]->share() );
     }
     return tmp;
 }
@@ -788,7 +796,7 @@ Expression Expression::getPow( const Expression& arg ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Power( element[run1]->clone(), arg.element[0]->clone() ); 
+        tmp.element[run1] = OperatorStore::getBinary( ON_POWER, element[run1]->share(), arg.element[0]->share() );
     }
     return tmp;
 }
@@ -801,7 +809,7 @@ Expression Expression::getPowInt( const int &arg ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Power_Int( element[run1]->clone(), arg );
+        tmp.element[run1] = OperatorStore::getPowerInt( element[run1]->share(), arg );
     }
     return tmp;
 }
@@ -817,7 +825,7 @@ Expression Expression::transpose( ) const{
     for( run1 = 0; run1 < getNumRows(); run1++ ){
         for( run2 = 0; run2 < getNumCols(); run2++ ){
              delete tmp.element[run2*getNumRows()+run1];
-             tmp.element[run2*getNumRows()+run1] = element[run1*getNumCols()+run2]->clone();
+             tmp.element[run2*getNumRows()+run1] = element[run1*getNumCols()+run2]->share();
         }
     }
     return tmp;
@@ -976,9 +984,47 @@ Expression Expression::ADforward ( const Expression &arg ) const{
 	Expression result("", getNumRows(), arg.getNumRows());
 
     uint run1, run2;
+    int  col;
 
     Expression seed( arg.getNumRows() );
 
+    // STRUCTURALLY ORTHOGONAL COLUMNS SHARE ONE SEED DIRECTION:
+    // ---------------------------------------------------------
+    JacobianColoring coloring;
+    if( arg.getNumRows() > 1 )
+        coloring.init( getJacobianSparsityPattern( arg ) );
+
+    if( coloring.isCompressing() == BT_TRUE ){
+
+        for( run1 = 0; run1 < (uint) coloring.getNumberOfColors(); run1++ ){
+
+            for( run2 = 0; run2 < arg.getNumRows(); run2++ ){
+                if( coloring.getColor( run2 ) == (int) run1 ){
+                    delete seed.element[run2];
+                    seed.element[run2] = new DoubleConstant( 1.0, NE_ONE );
+                }
+            }
+
+            Expression tmp = ADforward( arg, seed );
+
+            for( run2 = 0; run2 < arg.getNumRows(); run2++ ){
+                if( coloring.getColor( run2 ) == (int) run1 ){
+                    delete seed.element[run2];
+                    seed.element[run2] = new DoubleConstant( 0.0, NE_ZERO );
+                }
+            }
+
+            for( run2 = 0; run2 < getNumRows(); run2++ ){
+                col = coloring.getColumn( run2, run1 );
+                if( col >= 0 ){
+                    delete result.element[run2*arg.getNumRows()+col];
+                    result.element[run2*arg.getNumRows()+col] = tmp.element[run2]->share();
+                }
+            }
+        }
+        return result;
+    }
+
     for( run1 = 0; run1 < arg.getNumRows(); run1++ ){
 
         delete seed.element[run1];
@@ -991,7 +1037,7 @@ Expression Expression::ADforward ( const Expression &arg ) const{
 
         for( run2 = 0; run2 < getNumRows(); run2++ ){
             delete result.element[run2*arg.getNumRows()+run1];
-            result.element[run2*arg.getNumRows()+run1] = tmp.element[run2]->clone();
+            result.element[run2*arg.getNumRows()+run1] = tmp.element[run2]->share();
         }
     }
 
@@ -1021,7 +1067,7 @@ Expression Expression::ADforward ( const VariableType &varType_, const int *arg,
 
         for( run2 = 0; run2 < (int) getNumRows(); run2++ ){
             delete result.element[run2*nV+run1];
-            result.element[run2*nV+run1] = tmp.element[run2]->clone();
+            result.element[run2*nV+run1] = tmp.element[run2]->share();
         }
     }
     return result;
@@ -1052,7 +1098,7 @@ Expression Expression::ADbackward ( const Expression &arg ) const{
 
         for( run2 = 0; run2 < arg.getNumRows(); run2++ ){
             delete result.element[run1*arg.getNumRows()+run2];
-            result.element[run1*arg.getNumRows()+run2] = tmp.element[run2]->clone();
+            result.element[run1*arg.getNumRows()+run2] = tmp.element[run2]->share();
         }
     }
 
@@ -1226,6 +1272,10 @@ Expression Expression::ADbackward( const Expression &arg, const Expression &seed
 	
     for( run1 = 0; run1 < (int) getDim(); run1++ ){
 
+        // components with zero seed do not contribute:
+        if( seed.element[run1]->isOneOrZero() == NE_ZERO )
+            continue;
+
         Operator *seed1 = seed.element[run1]->clone();
 
         for( run2 = 0; run2 < Dim; run2++ )
@@ -1234,13 +1284,8 @@ Expression Expression::ADbackward( const Expression &arg, const Expression &seed
         element[run1]->initDerivative();
         element[run1]->AD_backward( Dim, varType, Component, seed1, iresult, nIS, &IS );
 
-        for( run2 = 0; run2 < Dim; run2++ ){
-            Operator *sum = result.element[run2]->clone();
-            delete result.element[run2];
-            result.element[run2] = new Addition( sum->clone(), iresult[run2]->clone() );
-            delete sum;
-            delete iresult[run2];
-        }
+        for( run2 = 0; run2 < Dim; run2++ )
+            result.element[run2] = new Addition( result.element[run2], iresult[run2] );
     }
 
 
@@ -1453,8 +1498,9 @@ Expression Expression::operator-() const{
     for( run1 = 0; run1 < getNumRows(); run1++ ){
         for( run2 = 0; run2 < getNumCols(); run2++ ){
              delete tmp.element[run1*getNumCols()+run2];
-             tmp.element[run1*getNumCols()+run2] = new Subtraction( new DoubleConstant(0.0,NE_ZERO),
-                                                                    element[run1*getNumCols()+run2]->clone() );
+             tmp.element[run1*getNumCols()+run2] = OperatorStore::getBinary( ON_SUBTRACTION,
+                                                                    OperatorStore::getConstant(0.0,NE_ZERO),
+                                                                    element[run1*getNumCols()+run2]->share() );
         }
     }
     return tmp;
@@ -1507,7 +1553,7 @@ void Expression::copy(const Expression &rhs)
 	for (i = 0; i < dim; i++)
 	{
 		if (rhs.element[i] != 0)
-			element[i] = rhs.element[i]->clone();
+			element[i] = rhs.element[i]->share();
 		else
 			element[i] = 0;
 	}
@@ -1532,7 +1578,7 @@ Expression& Expression::assignmentSetup(const Expression &arg)
 	{
 		arg.element[i]->isVariable(tt, comp);
 		if (tt == VT_INTERMEDIATE_STATE)
-			element[i] = arg.element[i]->clone();
+			element[i] = arg.element[i]->share();
 		else
 		{
 			std::stringstream tmpName;
@@ -1557,13 +1603,23 @@ void Expression::deleteAll( ){
     uint i;
 
     for( i = 0; i < dim; i++ )
-        if( element[i] != 0 )
-            delete element[i];
+        Operator::release( element[i] );
 
     if( element != 0 ) free(element);
 }
 
 
+void Expression::detachElement( uint idx ){
+
+    if( element[idx] == 0 || element[idx]->isShared() == BT_FALSE )
+        return;
+
+    Operator *tmp = element[idx]->clone();
+    Operator::release( element[idx] );
+    element[idx] = tmp;
+}
+
+
 
 
 BooleanType Expression::isDependingOn( VariableType type ) const{
@@ -1598,6 +1654,21 @@ Operator* Expression::getOperatorClone( uint idx ) const{
 }
 
 
+Expression Expression::getDeepCopy( ) const{
+
+    Expression tmp( *this );
+
+    uint i;
+    for( i = 0; i < dim; i++ ){
+        if( tmp.element[i] != 0 ){
+            Operator::release( tmp.element[i] );
+            tmp.element[i] = element[i]->clone();
+        }
+    }
+    return tmp;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
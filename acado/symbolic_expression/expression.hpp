@@ -51,6 +51,12 @@ class Operator;
  *  Moreover, the Expression class defines all kind of matrix
  *  and vector operations on a symbolic level.
  *
+ *  The operators of an expression are reference counted and created
+ *  via the OperatorStore, such that structurally identical
+ *  subexpressions exist only once and copies of expressions do not
+ *  clone any operator trees. Shared operators are never modified in
+ *  place: elements that are assigned via operator() are detached first.
+ *
  *  \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
  */
 class Expression
@@ -92,7 +98,7 @@ public:
 							uint         globalTypeID   = 0            /**< the global type ID      */
 							);
 
-	/** Copy constructor (deep copy). */
+	/** Copy constructor (the operators are shared, not cloned). */
 	Expression( const double& rhs );
 	Expression( const DVector      & rhs );
 	Expression( const DMatrix      & rhs );
@@ -164,6 +170,14 @@ public:
 
 	DMatrix getSparsityPattern() const;
 
+	/** When operated on an n x 1 Expression, returns the structural m x n
+	* sparsity pattern of the Jacobian with respect to arg. Unlike
+	* getDependencyPattern() it is determined from the operator trees without
+	* evaluating derivatives, hence it may contain entries that vanish numerically.
+	* \param arg m x 1 Expression
+	*/
+	DMatrix getJacobianSparsityPattern( const Expression& arg ) const;
+
 	Expression getSin    ( ) const;
 	Expression getCos    ( ) const;
 	Expression getTan    ( ) const;
@@ -271,6 +285,11 @@ public:
 	 *  \return A clone of the requested operator. */
 	Operator* getOperatorClone( uint idx ) const;
 
+	/** Returns a deep copy of the expression, i.e. a copy which does
+	 *  not share any operator with this expression.
+	 *  \return A deep copy of the expression. */
+	Expression getDeepCopy( ) const;
+
 	/** Returns the variable type
 	 *  \return The the variable type. */
 	inline VariableType getVariableType( ) const;
@@ -301,12 +320,16 @@ protected:
 	/** Generic destructor (protected, only for internal use). */
 	void deleteAll( );
 
+	/** Replaces the element idx by a private clone if it is shared,
+	 *  such that it can be modified in place (protected, only for internal use). */
+	void detachElement( uint idx );
+
 	/** Generic copy routine (protected, only for internal use).
 	 */
 	Expression& assignmentSetup( const Expression &arg );
 
 	/** Internal product routine (protected, only for internal use). */
-	Operator* product( const Operator *a, const Operator *b ) const;
+	Operator* product( Operator *a, Operator *b ) const;
 
 	Operator**         element     ;   /**< Element of vector space.   */
 	uint               dim         ;   /**< DVector space dimension.    */
@@ -230,8 +230,14 @@ void BinaryOperator::copy( const BinaryOperator &arg ){
 
 void BinaryOperator::deleteAll(){
 
-    if( argument1 != 0 ) delete argument1;
-    if( argument2 != 0 ) delete argument2;
+    if( argument1 != 0 ){
+        if( argument1->nCount == 0 ) delete argument1;
+        else                         argument1->nCount--;
+    }
+    if( argument2 != 0 ){
+        if( argument2->nCount == 0 ) delete argument2;
+        else                         argument2->nCount--;
+    }
 
     if( dargument1 != NULL ){
         delete dargument1;
@@ -48,9 +48,49 @@ Operator::Operator(){
 
     nCount = 0;
     initialized = BT_FALSE;
+    isStored = BT_FALSE;
 }
 
-Operator::~Operator(){ }
+Operator::~Operator(){
+
+    if( isStored == BT_TRUE )
+        OperatorStore::remove( this );
+}
+
+
+void* Operator::operator new( size_t size ){
+
+    return OperatorArena::allocate( size );
+}
+
+
+void Operator::operator delete( void *node ){
+
+    OperatorArena::deallocate( node );
+}
+
+
+Operator* Operator::share( ){
+
+    nCount++;
+    return this;
+}
+
+
+void Operator::release( Operator *arg ){
+
+    if( arg == 0 ) return;
+
+    if( arg->nCount == 0 ) delete arg;
+    else                   arg->nCount--;
+}
+
+
+BooleanType Operator::isShared( ) const{
+
+    if( nCount > 0 || isStored == BT_TRUE ) return BT_TRUE;
+    return BT_FALSE;
+}
 
 
 Operator& Operator::operator=( const double &arg ){
@@ -212,6 +252,9 @@ double Operator::getValue() const{ return INFTY; }
 
 std::ostream& operator<<(std::ostream &stream, const Operator &arg)
 {
+	if ( arg.exportAlias.empty() == false )
+		return stream << arg.exportAlias;
+
 	return arg.print( stream );
 }
 
@@ -227,6 +270,12 @@ returnValue Operator::setVariableExportName(	const VariableType &_type,
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue Operator::setExportAlias( const std::string& _alias )
+{
+	exportAlias = _alias;
+	return SUCCESSFUL_RETURN;
+}
+
 
 
 Operator* Operator::myProd(Operator* a,Operator* b){
@@ -68,6 +68,13 @@ public:
     virtual ~Operator();
 
 
+    /** Allocates an operator in the current OperatorArena (or on the heap). */
+    static void* operator new( size_t size );
+
+    /** Gives the memory of an operator back to its OperatorArena. */
+    static void operator delete( void *node );
+
+
     /** Sets the argument (note that arg should have dimension 1). */
 
     virtual Operator& operator=( const double      & arg );
@@ -556,6 +563,26 @@ public:
     int nCount;
 
 
+    /** Returns a shared reference to this operator, i.e. the reference \n
+     *  counter nCount is increased instead of cloning the whole tree.  \n
+     *  Every shared reference has to be given back via release().     \n
+     *                                                                  \n
+     *  \return this operator.                                          \n
+     */
+    Operator* share( );
+
+    /** Gives back one reference to arg: the reference counter is       \n
+     *  decreased if arg is shared and arg is deleted otherwise.        \n
+     */
+    static void release( Operator *arg );
+
+    /** Returns BT_TRUE if the operator is referenced more than once or \n
+     *  is kept in the OperatorStore. Shared operators must not be      \n
+     *  modified in place.                                              \n
+     */
+    BooleanType isShared( ) const;
+
+
 
 	/** Sets the name of the variable that is used for code export.   \n
 	 *  \return SUCCESSFUL_RETURN                                     \n
@@ -564,6 +591,14 @@ public:
     											const std::vector< std::string >& _name
     											);
 
+	/** Sets a name under which the operator is referenced when it is  \n
+	 *  printed as argument of another operator, e.g. an auxiliary     \n
+	 *  variable introduced by common subexpression elimination. An    \n
+	 *  empty name makes the operator print its expression again.      \n
+	 *  \return SUCCESSFUL_RETURN                                      \n
+	 */
+    returnValue setExportAlias( const std::string& _alias );
+
 
     
     
@@ -640,6 +675,11 @@ protected:
     protected:
 
       	BooleanType  initialized;
+      	BooleanType  isStored;      /**< Whether the operator is kept in the OperatorStore. */
+      	std::string  exportAlias;   /**< Name that is printed instead of the expression.    */
+
+
+    friend class OperatorStore;
 
 
 };
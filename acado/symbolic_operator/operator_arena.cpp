@@ -0,0 +1,311 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file src/symbolic_operator/operator_arena.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ *    \date 2014
+ */
+
+
+#include <acado/symbolic_operator/operator_arena.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/* Every block starts with a header that tells where it belongs to;     */
+/* the operator follows, such that it keeps the alignment of the block. */
+struct OperatorArenaHeader{
+
+    OperatorArenaData *arena;   /* the arena of the block, 0 for heap blocks */
+    size_t             size;    /* the size of the operator                   */
+};
+
+static const size_t operatorArenaAlignment  = 16;
+static const size_t operatorArenaHeaderSize = ( ( sizeof(OperatorArenaHeader) + operatorArenaAlignment - 1 ) / operatorArenaAlignment ) * operatorArenaAlignment;
+static const size_t operatorArenaChunkSize  = 65536;
+static const int    operatorArenaNumClasses = 64;  /* blocks up to 1 kB are kept in the chunks */
+
+
+static inline size_t getOperatorArenaBlockSize( size_t size ){
+
+    return ( ( operatorArenaHeaderSize + size + operatorArenaAlignment - 1 ) / operatorArenaAlignment ) * operatorArenaAlignment;
+}
+
+
+/* The chunks and free lists (one per block size) of an arena. The thread */
+/* that owns the arena allocates and deletes without locking; operators   */
+/* deleted on other threads are collected in a separate list under the    */
+/* mutex. Once the arena is closed, all deletions go through the mutex.   */
+struct OperatorArenaData{
+
+    OperatorArenaData( ){
+
+        for( int run1 = 0; run1 < operatorArenaNumClasses; run1++ )
+            freeList[run1] = 0;
+
+        owner        = std::this_thread::get_id();
+        current      = 0;
+        remaining    = 0;
+        nNodes       = 0;
+        nBytes       = 0;
+        remoteList   = 0;
+        hasRemote    = false;
+        nRemoteNodes = 0;
+        nRemoteBytes = 0;
+        isClosed     = false;
+    }
+
+    ~OperatorArenaData( ){
+
+        for( unsigned run1 = 0; run1 < chunks.size(); run1++ )
+            ::operator delete( chunks[run1] );
+    }
+
+    /* Puts a block back into the free list of its size. */
+    void recycle( OperatorArenaHeader *header ){
+
+        int blockClass = (int) ( getOperatorArenaBlockSize( header->size ) / operatorArenaAlignment ) - 1;
+
+        *(void**)( (char*)header + operatorArenaHeaderSize ) = freeList[blockClass];
+        freeList[blockClass] = header;
+    }
+
+    /* Moves the blocks deleted on other threads into the free lists. */
+    void collectRemoteList( ){
+
+        std::lock_guard< std::mutex > lock( mutex );
+
+        while( remoteList != 0 ){
+            OperatorArenaHeader *header = (OperatorArenaHeader*) remoteList;
+            remoteList = *(void**)( (char*)header + operatorArenaHeaderSize );
+            recycle( header );
+        }
+        hasRemote = false;
+        nNodes -= nRemoteNodes;
+        nBytes -= nRemoteBytes;
+        nRemoteNodes = 0;
+        nRemoteBytes = 0;
+    }
+
+    std::thread::id      owner;
+    std::vector< void* > chunks;
+    void                *freeList[operatorArenaNumClasses];
+    char                *current;       /* the unused part of the last chunk        */
+    size_t               remaining;
+    int                  nNodes;        /* operators allocated and not deleted by   */
+    long                 nBytes;        /* the owner (or, once closed, by anyone)   */
+
+    std::atomic< bool >  hasRemote;     /* whether the remote list is not empty     */
+
+    std::mutex           mutex;         /* protects the members below               */
+    void                *remoteList;    /* blocks deleted on other threads          */
+    int                  nRemoteNodes;
+    long                 nRemoteBytes;
+    bool                 isClosed;      /* whether the OperatorArena object is gone */
+};
+
+
+static thread_local OperatorArenaData *currentOperatorArena = 0;
+
+static std::atomic< int  > operatorArenaTotalNodes( 0 );
+static std::atomic< long > operatorArenaTotalBytes( 0 );
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+OperatorArena::OperatorArena( ){
+
+    data     = new OperatorArenaData;
+    previous = currentOperatorArena;
+
+    currentOperatorArena = data;
+}
+
+
+OperatorArena::~OperatorArena( ){
+
+    if( currentOperatorArena == data )
+        currentOperatorArena = previous;
+
+    bool isUnused;
+    {
+        std::lock_guard< std::mutex > lock( data->mutex );
+
+        data->isClosed = true;
+        data->nNodes  -= data->nRemoteNodes;
+        data->nBytes  -= data->nRemoteBytes;
+        data->nRemoteNodes = 0;
+        data->nRemoteBytes = 0;
+
+        isUnused = ( data->nNodes == 0 );
+    }
+    if( isUnused == true )
+        delete data;
+}
+
+
+int OperatorArena::getNumberOfNodes( ) const{
+
+    std::lock_guard< std::mutex > lock( data->mutex );
+    return data->nNodes - data->nRemoteNodes;
+}
+
+
+long OperatorArena::getNumberOfBytes( ) const{
+
+    std::lock_guard< std::mutex > lock( data->mutex );
+    return data->nBytes - data->nRemoteBytes;
+}
+
+
+long OperatorArena::getNumberOfReservedBytes( ) const{
+
+    return (long) ( data->chunks.size()*operatorArenaChunkSize );
+}
+
+
+int OperatorArena::getTotalNumberOfNodes( ){
+
+    return operatorArenaTotalNodes.load( std::memory_order_relaxed );
+}
+
+
+long OperatorArena::getTotalNumberOfBytes( ){
+
+    return operatorArenaTotalBytes.load( std::memory_order_relaxed );
+}
+
+
+void* OperatorArena::allocate( size_t size ){
+
+    OperatorArenaData   *arena  = currentOperatorArena;
+    OperatorArenaHeader *header = 0;
+
+    size_t blockSize  = getOperatorArenaBlockSize( size );
+    int    blockClass = (int) ( blockSize / operatorArenaAlignment ) - 1;
+
+    operatorArenaTotalNodes.fetch_add( 1, std::memory_order_relaxed );
+    operatorArenaTotalBytes.fetch_add( (long) size, std::memory_order_relaxed );
+
+    if( arena == 0 || blockClass >= operatorArenaNumClasses ){
+        header = (OperatorArenaHeader*) ::operator new( blockSize );
+        header->arena = 0;
+        header->size  = size;
+        return (char*)header + operatorArenaHeaderSize;
+    }
+
+    if( arena->freeList[blockClass] == 0 && arena->hasRemote == true )
+        arena->collectRemoteList( );
+
+    if( arena->freeList[blockClass] != 0 ){
+        header = (OperatorArenaHeader*) arena->freeList[blockClass];
+        arena->freeList[blockClass] = *(void**)( (char*)header + operatorArenaHeaderSize );
+    }
+    else{
+        if( arena->remaining < blockSize ){
+            arena->current   = (char*) ::operator new( operatorArenaChunkSize );
+            arena->remaining = operatorArenaChunkSize;
+            arena->chunks.push_back( arena->current );
+        }
+        header = (OperatorArenaHeader*) arena->current;
+        arena->current   += blockSize;
+        arena->remaining -= blockSize;
+    }
+
+    arena->nNodes++;
+    arena->nBytes += (long) size;
+
+    header->arena = arena;
+    header->size  = size;
+
+    return (char*)header + operatorArenaHeaderSize;
+}
+
+
+void OperatorArena::deallocate( void *node ){
+
+    if( node == 0 ) return;
+
+    OperatorArenaHeader *header = (OperatorArenaHeader*)( (char*)node - operatorArenaHeaderSize );
+    OperatorArenaData   *arena  = header->arena;
+
+    operatorArenaTotalNodes.fetch_sub( 1, std::memory_order_relaxed );
+    operatorArenaTotalBytes.fetch_sub( (long) header->size, std::memory_order_relaxed );
+
+    if( arena == 0 ){
+        ::operator delete( header );
+        return;
+    }
+
+    // only the owner can close the arena, so it can skip the lock before:
+    if( arena == currentOperatorArena || ( arena->owner == std::this_thread::get_id() && arena->isClosed == false ) ){
+        arena->recycle( header );
+        arena->nNodes--;
+        arena->nBytes -= (long) header->size;
+        return;
+    }
+
+    bool isUnused = false;
+    {
+        std::lock_guard< std::mutex > lock( arena->mutex );
+
+        if( arena->isClosed == true ){
+            arena->recycle( header );
+            arena->nNodes--;
+            arena->nBytes -= (long) header->size;
+            isUnused = ( arena->nNodes == 0 );
+        }
+        else{
+            *(void**)node = arena->remoteList;
+            arena->remoteList = header;
+            arena->hasRemote  = true;
+            arena->nRemoteNodes++;
+            arena->nRemoteBytes += (long) header->size;
+        }
+    }
+
+    // the last operator of a closed arena releases all chunks at once:
+    if( isUnused == true )
+        delete arena;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
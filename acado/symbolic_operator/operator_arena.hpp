@@ -0,0 +1,154 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file include/acado/symbolic_operator/operator_arena.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_ARENA_HPP
+#define ACADO_TOOLKIT_OPERATOR_ARENA_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+#include <cstddef>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+struct OperatorArenaData;
+
+
+/**
+ *	\brief Pool allocator for the operators of one expression-construction session.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  All operators (including tree projections) are allocated via the class
+ *  OperatorArena. While an OperatorArena object exists, it is the current
+ *  arena of the thread that created it: operators created on this thread,
+ *  e.g. when building a model or differentiating it symbolically, are
+ *  placed into large memory chunks of the arena instead of being allocated
+ *  one by one. Deleted operators are recycled within the arena, and the
+ *  chunks are released in bulk once the arena has been destroyed and the
+ *  last of its operators has been deleted. Operators may thus outlive the
+ *  OperatorArena object. Outside of an arena, operators are allocated on
+ *  the heap as usual.
+ *
+ *  Arenas can be nested; they have to be destroyed in reverse order of
+ *  their creation and on the thread that created them. Operators of an
+ *  arena may be deleted on any thread; the thread that owns the arena
+ *  allocates and deletes without locking.
+ *
+ *  The counters report the number of operators and the bytes they occupy,
+ *  both per arena and in total.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+class OperatorArena{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor, which makes the new arena the current one \n
+     *  of the calling thread.                                          \n
+     */
+    OperatorArena( );
+
+    /** Destructor, which restores the previous arena of the calling \n
+     *  thread. The memory is released as soon as all operators of   \n
+     *  the arena have been deleted.                                 \n
+     */
+    ~OperatorArena( );
+
+
+    /** Returns the number of operators that are alive in the arena. */
+    int getNumberOfNodes( ) const;
+
+    /** Returns the number of bytes occupied by the operators that are \n
+     *  alive in the arena.                                            \n
+     */
+    long getNumberOfBytes( ) const;
+
+    /** Returns the number of bytes reserved by the arena. */
+    long getNumberOfReservedBytes( ) const;
+
+
+    /** Returns the number of operators that are alive (in any arena \n
+     *  or on the heap).                                             \n
+     */
+    static int getTotalNumberOfNodes( );
+
+    /** Returns the number of bytes occupied by all operators that are \n
+     *  alive (in any arena or on the heap).                           \n
+     */
+    static long getTotalNumberOfBytes( );
+
+
+    /** Allocates the memory for an operator of the given size in the \n
+     *  current arena of the calling thread (or on the heap).         \n
+     */
+    static void* allocate( size_t size );
+
+    /** Gives the memory of an operator back to its arena (or to the heap). */
+    static void deallocate( void *node );
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Copying arenas is not supported. */
+    OperatorArena( const OperatorArena &arg );
+
+    /** Copying arenas is not supported. */
+    OperatorArena& operator=( const OperatorArena &arg );
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    OperatorArenaData *data;        /**< The chunks and free lists of the arena.          */
+    OperatorArenaData *previous;    /**< Previous arena of the thread that created it.   */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_OPERATOR_ARENA_HPP
+
+// end of file.
@@ -0,0 +1,425 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/symbolic_operator/operator_cse.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <cstring>
+#include <map>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// LOCAL HELPER FUNCTIONS AND CLASSES:
+//
+
+/* Identifies a node by its name, the numbers of its arguments and its value. */
+struct OperatorCSEKey{
+
+	int    name;
+	int    argument1;
+	int    argument2;
+	double value;
+
+	bool operator<( const OperatorCSEKey &arg ) const{
+
+		if( name      != arg.name      ) return name      < arg.name     ;
+		if( argument1 != arg.argument1 ) return argument1 < arg.argument1;
+		if( argument2 != arg.argument2 ) return argument2 < arg.argument2;
+
+		// compare bitwise, such that e.g. 0.0 and -0.0 are kept apart:
+		return memcmp( &value, &arg.value, sizeof(double) ) < 0;
+	}
+};
+
+
+/**
+ *	\brief Numbers the nodes of operator trees by their structure.
+ *
+ *	The numbering walks an operator tree via the templated evaluation
+ *	interface. Every node that has not been seen before gets a new number
+ *	and increases the use counts of its arguments; variables that are
+ *	bound to a node get the number of this node. The member res holds
+ *	the number of the most recently visited node.
+ */
+class OperatorCSENumbering : public EvaluationBase{
+
+public:
+
+	OperatorCSENumbering( vector< int >& _nodeArgument1, vector< int >& _nodeArgument2,
+						  vector< int >& _nodeUses, vector< vector< Operator* > >& _nodeOperators,
+						  int& _nOperations )
+		: nodeArgument1( _nodeArgument1 ), nodeArgument2( _nodeArgument2 ),
+		  nodeUses( _nodeUses ), nodeOperators( _nodeOperators ),
+		  nOperations( _nOperations ), res( -1 )
+	{}
+
+	virtual ~OperatorCSENumbering(){}
+
+	virtual void addition   ( Operator &arg1, Operator &arg2 ){ binary( ON_ADDITION,    arg1, arg2 ); }
+	virtual void subtraction( Operator &arg1, Operator &arg2 ){ binary( ON_SUBTRACTION, arg1, arg2 ); }
+	virtual void product    ( Operator &arg1, Operator &arg2 ){ binary( ON_PRODUCT,     arg1, arg2 ); }
+	virtual void quotient   ( Operator &arg1, Operator &arg2 ){ binary( ON_QUOTIENT,    arg1, arg2 ); }
+	virtual void power      ( Operator &arg1, Operator &arg2 ){ binary( ON_POWER,       arg1, arg2 ); }
+
+	virtual void powerInt( Operator &arg1, int &arg2 ){
+
+		int tmp = visit( arg1 );
+		nOperations++;
+		res = find( ON_POWER_INT, tmp, -1, (double)arg2 );
+	}
+
+	virtual void project( int &idx ){
+
+		map< int,int >::const_iterator it = variableNode.find( idx );
+
+		if( it != variableNode.end() )
+			res = it->second;
+		else
+			res = find( ON_VARIABLE, -1, -1, (double)idx );
+	}
+
+	virtual void set( double &arg ){ res = find( ON_DOUBLE_CONSTANT, -1, -1, arg ); }
+
+	virtual void Acos( Operator &arg ){ unary( ON_ACOS,      arg ); }
+	virtual void Asin( Operator &arg ){ unary( ON_ASIN,      arg ); }
+	virtual void Atan( Operator &arg ){ unary( ON_ATAN,      arg ); }
+	virtual void Cos ( Operator &arg ){ unary( ON_COS,       arg ); }
+	virtual void Exp ( Operator &arg ){ unary( ON_EXP,       arg ); }
+	virtual void Log ( Operator &arg ){ unary( ON_LOGARITHM, arg ); }
+	virtual void Sin ( Operator &arg ){ unary( ON_SIN,       arg ); }
+	virtual void Tan ( Operator &arg ){ unary( ON_TAN,       arg ); }
+
+	/** Numbers the node arg (and all nodes below) and returns its number. */
+	int visit( Operator &arg ){
+
+		arg.evaluate( this );
+		nodeOperators[ res ].push_back( &arg );
+		return res;
+	}
+
+	/** Numbers all references to the variable idx like the node node. */
+	void bind( int idx, int node ){
+
+		variableNode[ idx ] = node;
+	}
+
+protected:
+
+	int find( int name, int arg1, int arg2, double value ){
+
+		OperatorCSEKey key;
+
+		key.name      = name ;
+		key.argument1 = arg1 ;
+		key.argument2 = arg2 ;
+		key.value     = value;
+
+		map< OperatorCSEKey,int >::const_iterator it = table.find( key );
+
+		if( it != table.end() )
+			return it->second;
+
+		int idx = (int)nodeUses.size();
+
+		nodeArgument1.push_back( arg1 );
+		nodeArgument2.push_back( arg2 );
+		nodeUses.push_back( 0 );
+		nodeOperators.push_back( vector< Operator* >() );
+
+		if( arg1 >= 0 ) nodeUses[arg1]++;
+		if( arg2 >= 0 ) nodeUses[arg2]++;
+
+		table[ key ] = idx;
+		return idx;
+	}
+
+	void binary( int name, Operator &arg1, Operator &arg2 ){
+
+		int tmp1 = visit( arg1 );
+		int tmp2 = visit( arg2 );
+		nOperations++;
+
+		// additions and products are commutative in floating point arithmetic as well:
+		if( ( name == ON_ADDITION || name == ON_PRODUCT ) && tmp2 < tmp1 )
+			res = find( name, tmp2, tmp1, 0.0 );
+		else
+			res = find( name, tmp1, tmp2, 0.0 );
+	}
+
+	void unary( int name, Operator &arg ){
+
+		int tmp = visit( arg );
+		nOperations++;
+		res = find( name, tmp, -1, 0.0 );
+	}
+
+	vector< int >&                nodeArgument1;
+	vector< int >&                nodeArgument2;
+	vector< int >&                nodeUses;
+	vector< vector< Operator* > >& nodeOperators;
+	int&                          nOperations;
+
+	map< OperatorCSEKey,int >     table;
+	map< int,int >                variableNode;
+
+public:
+
+	int res;
+};
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+OperatorCSE::OperatorCSE( ){
+
+	nNamedRoots = 0;
+	nAuxiliary  = 0;
+	nOperations = 0;
+	nEliminated = 0;
+}
+
+
+OperatorCSE::~OperatorCSE( ){
+}
+
+
+returnValue OperatorCSE::analyze( int nRoots, Operator **roots, int nNamed, const int *namedIndex ){
+
+	int run1;
+
+	for( run1 = 0; run1 < nRoots; run1++ )
+		if( roots[run1]->isSymbolic() == BT_FALSE )
+			return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+	nodeArgument1.clear();
+	nodeArgument2.clear();
+	nodeUses.clear();
+	nodeAuxiliary.clear();
+	nodeOwner.clear();
+	nodeOperators.clear();
+	rootNode.clear();
+	rootFirstNode.clear();
+
+	nNamedRoots = nNamed;
+	nAuxiliary  = 0;
+	nOperations = 0;
+	nEliminated = 0;
+
+	OperatorCSENumbering numbering( nodeArgument1, nodeArgument2, nodeUses, nodeOperators, nOperations );
+
+	for( run1 = 0; run1 < nRoots; run1++ ){
+
+		rootFirstNode.push_back( (int)nodeUses.size() );
+		rootNode.push_back( numbering.visit( *roots[run1] ) );
+
+		if( run1 < nNamed )
+			numbering.bind( namedIndex[run1], rootNode[run1] );
+
+		// every tree is a reference to its node, such that identical
+		// trees are exported only once as well:
+		nodeUses[ rootNode[run1] ]++;
+	}
+	rootFirstNode.push_back( (int)nodeUses.size() );
+
+	// a node is computed by a named tree if it is created by this tree:
+	nodeOwner.resize( nodeUses.size(), -1 );
+
+	for( run1 = 0; run1 < nNamed; run1++ )
+		if( rootNode[run1] >= rootFirstNode[run1] )
+			nodeOwner[ rootNode[run1] ] = run1;
+
+	// Hoist all operations that are referenced more than once, unless
+	// they are exported as constant anyway. The nodes are numbered in
+	// post-order, so arguments are always exported first.
+	nodeAuxiliary.resize( nodeUses.size(), -1 );
+
+	for( run1 = 0; run1 < (int)nodeUses.size(); run1++ ){
+
+		if( nodeArgument1[run1] < 0 || nodeUses[run1] < 2 )
+			continue;
+
+		if( acadoIsFinite( nodeOperators[run1][0]->getValue() ) == BT_TRUE )
+			continue;
+
+		if( nodeOwner[run1] >= 0 )
+			nodeAuxiliary[run1] = nodeOwner[run1];
+		else
+			nodeAuxiliary[run1] = nNamed + nAuxiliary++;
+	}
+
+	// count the operations that remain after the elimination:
+	vector< int > memory( nodeUses.size(), -1 );
+	int nRemaining = 0;
+
+	for( run1 = 0; run1 < (int)nodeUses.size(); run1++ )
+		if( nodeAuxiliary[run1] >= 0 && nodeOwner[run1] < 0 )
+			nRemaining += getExportedOperations( run1, memory );
+
+	for( run1 = 0; run1 < nRoots; run1++ )
+		if( nodeAuxiliary[ rootNode[run1] ] < 0 || nodeOwner[ rootNode[run1] ] == run1 )
+			nRemaining += getExportedOperations( rootNode[run1], memory );
+
+	nEliminated = nOperations - nRemaining;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorCSE::exportAuxiliaryVariables( std::ostream &stream, int root,
+                                                   const std::string &name,
+                                                   int stride, const std::string &index ) const{
+
+	int run1, run2;
+
+	if( root < 0 || root+1 >= (int)rootFirstNode.size() )
+		return SUCCESSFUL_RETURN;
+
+	// The previous tree has been exported by now, so that its node can be
+	// referenced by its variable (unless it is exported as a constant):
+	if( root > 0 && root-1 < nNamedRoots && nodeOwner[ rootNode[root-1] ] == root-1 &&
+		nodeAuxiliary[ rootNode[root-1] ] >= 0 )
+		setAlias( rootNode[root-1], name, stride, index );
+
+	for( run1 = rootFirstNode[root]; run1 < rootFirstNode[root+1]; run1++ ){
+
+		if( nodeAuxiliary[run1] < 0 || nodeOwner[run1] >= 0 )
+			continue;
+
+		stream << getAuxiliaryName( nodeAuxiliary[run1], name, stride, index ) << " = ";
+		nodeOperators[run1][0]->print( stream );
+		stream << ";" << endl;
+
+		setAlias( run1, name, stride, index );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorCSE::clearAliases( ) const{
+
+	int run1, run2;
+
+	for( run1 = 0; run1 < (int)nodeOperators.size(); run1++ )
+		if( nodeAuxiliary[run1] >= 0 )
+			for( run2 = 0; run2 < (int)nodeOperators[run1].size(); run2++ )
+				nodeOperators[run1][run2]->setExportAlias( "" );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+int OperatorCSE::getNumberOfAuxiliaryVariables( ) const{
+
+	return nAuxiliary;
+}
+
+
+int OperatorCSE::getNumberOfOperations( ) const{
+
+	return nOperations;
+}
+
+
+int OperatorCSE::getNumberOfEliminatedOperations( ) const{
+
+	return nEliminated;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void OperatorCSE::setAlias( int idx, const std::string &name,
+                            int stride, const std::string &index ) const{
+
+	int run1;
+
+	const std::string alias = getAuxiliaryName( nodeAuxiliary[idx], name, stride, index );
+
+	for( run1 = 0; run1 < (int)nodeOperators[idx].size(); run1++ )
+		nodeOperators[idx][run1]->setExportAlias( alias );
+}
+
+
+std::string OperatorCSE::getAuxiliaryName( int aux, const std::string &name,
+                                           int stride, const std::string &index ) const{
+
+	stringstream auxName;
+
+	if( index.empty() == true )
+		auxName << name << "[" << aux << "]";
+	else if( aux == 0 )
+		auxName << name << "[" << index << "]";
+	else
+		auxName << name << "[" << aux*stride << " + " << index << "]";
+
+	return auxName.str();
+}
+
+
+int OperatorCSE::getExportedOperations( int idx, std::vector< int > &memory ) const{
+
+	if( memory[idx] >= 0 )
+		return memory[idx];
+
+	if( nodeArgument1[idx] < 0 ){
+		memory[idx] = 0;
+		return 0;
+	}
+
+	int result = 1;
+
+	if( nodeAuxiliary[ nodeArgument1[idx] ] < 0 )
+		result += getExportedOperations( nodeArgument1[idx], memory );
+
+	if( nodeArgument2[idx] >= 0 && nodeAuxiliary[ nodeArgument2[idx] ] < 0 )
+		result += getExportedOperations( nodeArgument2[idx], memory );
+
+	memory[idx] = result;
+	return result;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
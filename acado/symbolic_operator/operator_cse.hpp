@@ -0,0 +1,169 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/symbolic_operator/operator_cse.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_CSE_HPP
+#define ACADO_TOOLKIT_OPERATOR_CSE_HPP
+
+
+#include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Common subexpression elimination for the code export of operator trees.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class OperatorCSE numbers all nodes of a sequence of operator trees
+ *  by their structure, such that structurally identical subtrees get the
+ *  same number; this yields the DAG of the trees. Every non-trivial node
+ *  of the DAG that is used more than once is hoisted into an auxiliary
+ *  variable: it is exported only once, right before the first tree that
+ *  contains it, and all its occurrences are printed under the name of
+ *  the auxiliary variable (see Operator::setExportAlias).
+ *
+ *  The trees are not modified apart from their export aliases, which are
+ *  reset by clearAliases(). Only purely symbolic trees can be analysed.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+class OperatorCSE{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    OperatorCSE( );
+
+    /** Destructor. */
+    ~OperatorCSE( );
+
+
+    /** Numbers the nodes of the given trees and selects the nodes that   \n
+     *  are hoisted into auxiliary variables. The trees have to be given  \n
+     *  in the order in which they are exported. The first nNamed trees   \n
+     *  are stored in the variables name[0], ..., name[nNamed-1] (e.g.    \n
+     *  intermediate states); a hoisted node that is computed by one of   \n
+     *  them is referenced by this variable. All other auxiliary          \n
+     *  variables follow behind. References to the global variable index \n
+     *  of a named tree are numbered like the tree itself.                \n
+     *                                                                    \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS                 \n
+     */
+    returnValue analyze( int        nRoots     /**< number of trees                    */,
+                         Operator **roots      /**< the trees                          */,
+                         int        nNamed     /**< number of named trees              */,
+                         const int *namedIndex /**< global variable indices of the named trees */ );
+
+    /** Exports the auxiliary variables that are needed for the first  \n
+     *  time by the tree root and sets the export aliases of all their  \n
+     *  occurrences; the auxiliary variable k is exported as name[k],   \n
+     *  or as name[k*stride + index] if an index is given (e.g. for     \n
+     *  the point-wise layout of batched evaluations).                  \n
+     *  Has to be called for all trees in the order of analyze(),       \n
+     *  right before each tree is exported.                             \n
+     *                                                                  \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue exportAuxiliaryVariables( std::ostream      &stream      /**< the output stream           */,
+                                          int                root        /**< index of the tree           */,
+                                          const std::string &name        /**< name of the auxiliary array */,
+                                          int                stride = 1  /**< stride of the variables     */,
+                                          const std::string &index = ""  /**< index within the stride     */ ) const;
+
+    /** Resets the export aliases of all analysed operators. */
+    returnValue clearAliases( ) const;
+
+
+    /** Returns the number of auxiliary variables (without the named trees). */
+    int getNumberOfAuxiliaryVariables( ) const;
+
+    /** Returns the number of operations of the trees without elimination. */
+    int getNumberOfOperations( ) const;
+
+    /** Returns the number of operations that are saved by the elimination. */
+    int getNumberOfEliminatedOperations( ) const;
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Sets the export alias name[k] on all operators of the node idx, \n
+     *  where k is its auxiliary variable.                              \n
+     */
+    void setAlias( int idx, const std::string &name, int stride, const std::string &index ) const;
+
+    /** Returns the name of the auxiliary variable aux. */
+    std::string getAuxiliaryName( int aux, const std::string &name, int stride, const std::string &index ) const;
+
+    /** Returns the number of operations that are exported for the node \n
+     *  idx, where hoisted arguments are not counted.                    \n
+     */
+    int getExportedOperations( int idx, std::vector< int > &memory ) const;
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    std::vector< int >                      nodeArgument1;   /**< Number of the first argument of each node (or -1).  */
+    std::vector< int >                      nodeArgument2;   /**< Number of the second argument of each node (or -1). */
+    std::vector< int >                      nodeUses;        /**< Number of references to each node within the DAG.   */
+    std::vector< int >                      nodeAuxiliary;   /**< Auxiliary variable of each node (or -1).            */
+    std::vector< int >                      nodeOwner;       /**< Named tree that computes each node (or -1).         */
+    std::vector< std::vector< Operator* > > nodeOperators;   /**< All operators that represent each node.             */
+
+    std::vector< int >                      rootNode;        /**< Number of the node of each tree.                    */
+    std::vector< int >                      rootFirstNode;   /**< First node that is created by each tree.            */
+
+    int                                     nNamedRoots;     /**< Number of named trees.                              */
+    int                                     nAuxiliary;      /**< Number of auxiliary variables.                      */
+    int                                     nOperations;     /**< Number of operations without elimination.           */
+    int                                     nEliminated;     /**< Number of eliminated operations.                    */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_OPERATOR_CSE_HPP
+
+// end of file.
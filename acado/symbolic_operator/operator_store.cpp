@@ -0,0 +1,231 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/symbolic_operator/operator_store.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ *    \date 2014
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <cstring>
+#include <map>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/* Identifies an operator by its name, its arguments and its value. */
+struct OperatorStoreKey{
+
+    int             name;
+    int             info;
+    const Operator *argument1;
+    const Operator *argument2;
+    double          value;
+
+    bool operator<( const OperatorStoreKey &arg ) const{
+
+        if( name      != arg.name      ) return name      < arg.name     ;
+        if( info      != arg.info      ) return info      < arg.info     ;
+        if( argument1 != arg.argument1 ) return argument1 < arg.argument1;
+        if( argument2 != arg.argument2 ) return argument2 < arg.argument2;
+
+        // compare bitwise, such that e.g. 0.0 and -0.0 are kept apart:
+        return memcmp( &value, &arg.value, sizeof(double) ) < 0;
+    }
+};
+
+typedef std::map< OperatorStoreKey, Operator* >       OperatorStoreTable;
+typedef std::map< const Operator*, OperatorStoreKey > OperatorStoreIndex;
+
+
+/* The tables are created on first use and never destroyed, as operators */
+/* might still be deleted during the destruction of static objects.      */
+static OperatorStoreTable& getOperatorStoreTable( ){
+
+    static OperatorStoreTable *table = new OperatorStoreTable;
+    return *table;
+}
+
+static OperatorStoreIndex& getOperatorStoreIndex( ){
+
+    static OperatorStoreIndex *index = new OperatorStoreIndex;
+    return *index;
+}
+
+static int operatorStoreHits = 0;
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+Operator* OperatorStore::getConstant( double value, NeutralElement ne ){
+
+    Operator *node = lookUp( ON_DOUBLE_CONSTANT, ne, 0, 0, value );
+    if( node != 0 ) return node;
+
+    return insert( new DoubleConstant( value, ne ), ON_DOUBLE_CONSTANT, ne, 0, 0, value );
+}
+
+
+Operator* OperatorStore::getUnary( OperatorName name, Operator *argument ){
+
+    Operator *node = lookUp( name, 0, argument, 0, 0.0 );
+    if( node != 0 ) return node;
+
+    switch( name ){
+
+        case ON_SIN      : node = new Sin      ( argument ); break;
+        case ON_COS      : node = new Cos      ( argument ); break;
+        case ON_TAN      : node = new Tan      ( argument ); break;
+        case ON_ASIN     : node = new Asin     ( argument ); break;
+        case ON_ACOS     : node = new Acos     ( argument ); break;
+        case ON_ATAN     : node = new Atan     ( argument ); break;
+        case ON_EXP      : node = new Exp      ( argument ); break;
+        case ON_LOGARITHM: node = new Logarithm( argument ); break;
+
+        default:
+             ACADOERROR( RET_UNKNOWN_BUG );
+             return 0;
+    }
+
+    return insert( node, name, 0, argument, 0, 0.0 );
+}
+
+
+Operator* OperatorStore::getBinary( OperatorName name, Operator *argument1, Operator *argument2 ){
+
+    Operator *node = lookUp( name, 0, argument1, argument2, 0.0 );
+    if( node != 0 ) return node;
+
+    switch( name ){
+
+        case ON_ADDITION   : node = new Addition   ( argument1, argument2 ); break;
+        case ON_SUBTRACTION: node = new Subtraction( argument1, argument2 ); break;
+        case ON_PRODUCT    : node = new Product    ( argument1, argument2 ); break;
+        case ON_QUOTIENT   : node = new Quotient   ( argument1, argument2 ); break;
+        case ON_POWER      : node = new Power      ( argument1, argument2 ); break;
+
+        default:
+             ACADOERROR( RET_UNKNOWN_BUG );
+             return 0;
+    }
+
+    return insert( node, name, 0, argument1, argument2, 0.0 );
+}
+
+
+Operator* OperatorStore::getPowerInt( Operator *argument, int exponent ){
+
+    Operator *node = lookUp( ON_POWER_INT, exponent, argument, 0, 0.0 );
+    if( node != 0 ) return node;
+
+    return insert( new Power_Int( argument, exponent ), ON_POWER_INT, exponent, argument, 0, 0.0 );
+}
+
+
+void OperatorStore::remove( const Operator *node ){
+
+    OperatorStoreIndex &index = getOperatorStoreIndex();
+    OperatorStoreIndex::iterator it = index.find( node );
+
+    if( it == index.end() ) return;
+
+    getOperatorStoreTable().erase( it->second );
+    index.erase( it );
+}
+
+
+int OperatorStore::getNumberOfNodes( ){
+
+    return (int) getOperatorStoreTable().size();
+}
+
+
+int OperatorStore::getNumberOfHits( ){
+
+    return operatorStoreHits;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+Operator* OperatorStore::lookUp( int name, int info, Operator *argument1, Operator *argument2, double value ){
+
+    OperatorStoreKey key;
+
+    key.name      = name     ;
+    key.info      = info     ;
+    key.argument1 = argument1;
+    key.argument2 = argument2;
+    key.value     = value    ;
+
+    OperatorStoreTable &table = getOperatorStoreTable();
+    OperatorStoreTable::iterator it = table.find( key );
+
+    if( it == table.end() ) return 0;
+
+    // the existing operator holds its own references to the arguments:
+    Operator::release( argument1 );
+    Operator::release( argument2 );
+
+    operatorStoreHits++;
+    return it->second->share();
+}
+
+
+Operator* OperatorStore::insert( Operator *node, int name, int info,
+                                 const Operator *argument1, const Operator *argument2, double value ){
+
+    OperatorStoreKey key;
+
+    key.name      = name     ;
+    key.info      = info     ;
+    key.argument1 = argument1;
+    key.argument2 = argument2;
+    key.value     = value    ;
+
+    getOperatorStoreTable()[key] = node;
+    getOperatorStoreIndex()[node] = key;
+
+    node->isStored = BT_TRUE;
+    return node;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,144 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/symbolic_operator/operator_store.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_STORE_HPP
+#define ACADO_TOOLKIT_OPERATOR_STORE_HPP
+
+
+#include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Hash-consing store for the operators built by symbolic expressions.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class OperatorStore makes sure that structurally identical operators
+ *  which are created by the class Expression exist only once: an operator
+ *  is identified by its name, the addresses of its arguments and (for
+ *  constants and integer powers) its value. If a requested operator exists
+ *  already, a shared reference to it is returned instead of a new node.
+ *  Together with the reference counter of the class Operator, this turns
+ *  the trees of an Expression into a DAG and makes copies of expressions
+ *  cheap.
+ *
+ *  All get-routines take over the references to the arguments that are
+ *  passed and return one reference to the requested operator, which has
+ *  to be given back via Operator::release(). Operators remove themselves
+ *  from the store when they are deleted.
+ *
+ *  Operators in the store are shared and must never be modified in place;
+ *  in particular, they are not evaluated directly: the class
+ *  FunctionEvaluationTree works on private clones. Note that the store is
+ *  not thread-safe.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+class OperatorStore{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Returns a reference to the constant with the given value. */
+    static Operator* getConstant( double         value  /**< value of the constant */,
+                                  NeutralElement ne     /**< its neutral element  */ );
+
+    /** Returns a reference to the unary operator name( argument ),   \n
+     *  where name is one of ON_SIN, ON_COS, ON_TAN, ON_ASIN, ON_ACOS, \n
+     *  ON_ATAN, ON_EXP and ON_LOGARITHM.                             \n
+     */
+    static Operator* getUnary( OperatorName  name     /**< name of the operator */,
+                               Operator     *argument /**< its argument         */ );
+
+    /** Returns a reference to the binary operator                          \n
+     *  name( argument1, argument2 ), where name is one of ON_ADDITION,     \n
+     *  ON_SUBTRACTION, ON_PRODUCT, ON_QUOTIENT and ON_POWER.               \n
+     */
+    static Operator* getBinary( OperatorName  name      /**< name of the operator */,
+                                Operator     *argument1 /**< first argument       */,
+                                Operator     *argument2 /**< second argument      */ );
+
+    /** Returns a reference to the integer power argument^exponent. */
+    static Operator* getPowerInt( Operator *argument /**< the base     */,
+                                  int       exponent /**< the exponent */ );
+
+
+    /** Removes an operator from the store (called on its deletion). */
+    static void remove( const Operator *node );
+
+
+    /** Returns the number of operators that are currently stored. */
+    static int getNumberOfNodes( );
+
+    /** Returns how many requests have been answered with an existing \n
+     *  operator instead of creating a new one.                        \n
+     */
+    static int getNumberOfHits( );
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Looks up the operator with the given key. If it exists, the  \n
+     *  argument references are given back and a new reference to the \n
+     *  operator is returned; otherwise 0 is returned.                \n
+     */
+    static Operator* lookUp( int             name,
+                             int             info,
+                             Operator       *argument1,
+                             Operator       *argument2,
+                             double          value );
+
+    /** Inserts a newly created operator into the store. */
+    static Operator* insert( Operator       *node,
+                             int             name,
+                             int             info,
+                             const Operator *argument1,
+                             const Operator *argument2,
+                             double          value );
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_OPERATOR_STORE_HPP
+
+// end of file.
@@ -0,0 +1,835 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/symbolic_operator/operator_tape.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <map>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// LOCAL HELPER FUNCTIONS AND CLASSES:
+//
+
+/** Number of integers that make up one instruction of the tape. */
+static const int OT_INSTRUCTION_SIZE = 4;
+
+
+static inline bool isBinaryCode( int op ){
+
+	return ( op >= OTC_ADDITION ) && ( op <= OTC_POWER );
+}
+
+
+static inline double unaryValue( int op, double x ){
+
+	switch( op ){
+		case OTC_SIN:       return sin( x );
+		case OTC_COS:       return cos( x );
+		case OTC_TAN:       return tan( x );
+		case OTC_ASIN:      return asin( x );
+		case OTC_ACOS:      return acos( x );
+		case OTC_ATAN:      return atan( x );
+		case OTC_EXP:       return exp( x );
+		case OTC_LOGARITHM: return log( x );
+		default:            return x;
+	}
+}
+
+
+static inline double unaryDerivative( int op, double x ){
+
+	double v1;
+
+	switch( op ){
+		case OTC_SIN:       return cos( x );
+		case OTC_COS:       return -sin( x );
+		case OTC_TAN:       v1 = tan( x ); return 1+v1*v1;
+		case OTC_ASIN:      return 1/sqrt(1-x*x);
+		case OTC_ACOS:      return -1/sqrt(1-x*x);
+		case OTC_ATAN:      return 1/(1+x*x);
+		case OTC_EXP:       return exp( x );
+		case OTC_LOGARITHM: return 1/x;
+		default:            return 1.0;
+	}
+}
+
+
+static inline double unarySecondDerivative( int op, double x ){
+
+	double v1;
+
+	switch( op ){
+		case OTC_SIN:       return -sin( x );
+		case OTC_COS:       return -cos( x );
+		case OTC_TAN:       v1 = tan( x ); return 2*v1*(1+v1*v1);
+		case OTC_ASIN:      v1 = sqrt(1-x*x); return -2*x*(-0.5/v1/v1/v1);
+		case OTC_ACOS:      v1 = sqrt(1-x*x); return 2*x*(-0.5/v1/v1/v1);
+		case OTC_ATAN:      v1 = 1+x*x; return -2*x/v1/v1;
+		case OTC_EXP:       return exp( x );
+		case OTC_LOGARITHM: return -1/x/x;
+		default:            return 0.0;
+	}
+}
+
+
+/**
+ *	\brief Records symbolic operators on an OperatorTape.
+ *
+ *	The recorder walks an operator tree via the templated evaluation
+ *	interface and appends one instruction per operator node. The member
+ *	res holds the workspace slot of the most recently recorded node.
+ */
+class OperatorTapeRecorder : public EvaluationBase{
+
+public:
+
+	OperatorTapeRecorder( vector< int >& _code, vector< double >& _constants,
+						  vector< int >& _constantSlot, vector< int >& _inputIndex,
+						  vector< int >& _inputSlot, int& _nSlots )
+		: code( _code ), constants( _constants ), constantSlot( _constantSlot ),
+		  inputIndex( _inputIndex ), inputSlot( _inputSlot ), nSlots( _nSlots ), res( -1 )
+	{}
+
+	virtual ~OperatorTapeRecorder(){}
+
+	virtual void addition   ( Operator &arg1, Operator &arg2 ){ binary( OTC_ADDITION,    arg1, arg2 ); }
+	virtual void subtraction( Operator &arg1, Operator &arg2 ){ binary( OTC_SUBTRACTION, arg1, arg2 ); }
+	virtual void product    ( Operator &arg1, Operator &arg2 ){ binary( OTC_PRODUCT,     arg1, arg2 ); }
+	virtual void quotient   ( Operator &arg1, Operator &arg2 ){ binary( OTC_QUOTIENT,    arg1, arg2 ); }
+	virtual void power      ( Operator &arg1, Operator &arg2 ){ binary( OTC_POWER,       arg1, arg2 ); }
+
+	virtual void powerInt( Operator &arg1, int &arg2 ){
+
+		arg1.evaluate( this );
+		res = emit( OTC_POWER_INT, res, arg2 );
+	}
+
+	virtual void project( int &idx ){
+
+		map< int,int >::const_iterator it = variableSlot.find( idx );
+
+		if( it != variableSlot.end() ){
+			res = it->second;
+			return;
+		}
+		res = nSlots++;
+		inputIndex.push_back( idx );
+		inputSlot.push_back( res );
+		variableSlot[ idx ] = res;
+	}
+
+	virtual void set( double &arg ){
+
+		res = nSlots++;
+		constants.push_back( arg );
+		constantSlot.push_back( res );
+	}
+
+	virtual void Acos( Operator &arg ){ unary( OTC_ACOS,      arg ); }
+	virtual void Asin( Operator &arg ){ unary( OTC_ASIN,      arg ); }
+	virtual void Atan( Operator &arg ){ unary( OTC_ATAN,      arg ); }
+	virtual void Cos ( Operator &arg ){ unary( OTC_COS,       arg ); }
+	virtual void Exp ( Operator &arg ){ unary( OTC_EXP,       arg ); }
+	virtual void Log ( Operator &arg ){ unary( OTC_LOGARITHM, arg ); }
+	virtual void Sin ( Operator &arg ){ unary( OTC_SIN,       arg ); }
+	virtual void Tan ( Operator &arg ){ unary( OTC_TAN,       arg ); }
+
+	/** Records an intermediate expression and binds its result to the
+	 *  global variable index idx. */
+	int recordIntermediate( Operator &arg, int idx ){
+
+		int nInstructions = (int)code.size();
+
+		arg.evaluate( this );
+
+		// Each intermediate state needs a slot of its own, otherwise adjoints
+		// of aliased variables would get mixed up in backward mode.
+		if( (int)code.size() == nInstructions || code[code.size() - OT_INSTRUCTION_SIZE + 1] != res )
+			res = emit( OTC_COPY, res, -1 );
+
+		variableSlot[ idx ] = res;
+		return res;
+	}
+
+	int record( Operator &arg ){
+
+		arg.evaluate( this );
+		return res;
+	}
+
+protected:
+
+	int emit( int op, int arg1, int arg2 ){
+
+		int slot = nSlots++;
+
+		code.push_back( op );
+		code.push_back( slot );
+		code.push_back( arg1 );
+		code.push_back( arg2 );
+
+		return slot;
+	}
+
+	void binary( int op, Operator &arg1, Operator &arg2 ){
+
+		arg1.evaluate( this );
+		int tmp = res;
+		arg2.evaluate( this );
+		res = emit( op, tmp, res );
+	}
+
+	void unary( int op, Operator &arg ){
+
+		arg.evaluate( this );
+		res = emit( op, res, -1 );
+	}
+
+	vector< int >&    code;
+	vector< double >& constants;
+	vector< int >&    constantSlot;
+	vector< int >&    inputIndex;
+	vector< int >&    inputSlot;
+	int&              nSlots;
+
+	map< int,int >    variableSlot;
+
+public:
+
+	int res;
+};
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+OperatorTape::OperatorTape( ){
+
+	nSlots     = 0;
+	bufferSize = 0;
+}
+
+
+OperatorTape::OperatorTape( const OperatorTape& arg ){
+
+	*this = arg;
+}
+
+
+OperatorTape::~OperatorTape( ){
+}
+
+
+OperatorTape& OperatorTape::operator=( const OperatorTape& arg ){
+
+	if( this != &arg ){
+
+		code         = arg.code;
+		constants    = arg.constants;
+		constantSlot = arg.constantSlot;
+		inputIndex   = arg.inputIndex;
+		inputSlot    = arg.inputSlot;
+		subIndex     = arg.subIndex;
+		subSlot      = arg.subSlot;
+		outSlot      = arg.outSlot;
+		nSlots       = arg.nSlots;
+
+		// buffers are not copied, same as for the operator trees
+		bufferSize = 0;
+		w.clear();
+		dw.clear();
+		aux1.clear();
+		aux2.clear();
+
+		if( nSlots > 0 )
+			allocateBuffer( 0 );
+	}
+	return *this;
+}
+
+
+returnValue OperatorTape::compile( int nSub, Operator **sub, const int *subIndex_,
+                                   int nOut, Operator **out ){
+
+	int run1;
+
+	clear( );
+
+	for( run1 = 0; run1 < nSub; run1++ )
+		if( sub[run1]->isSymbolic() == BT_FALSE )
+			return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+	for( run1 = 0; run1 < nOut; run1++ )
+		if( out[run1]->isSymbolic() == BT_FALSE )
+			return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+	OperatorTapeRecorder recorder( code, constants, constantSlot, inputIndex, inputSlot, nSlots );
+
+	for( run1 = 0; run1 < nSub; run1++ ){
+		subIndex.push_back( subIndex_[run1] );
+		subSlot.push_back( recorder.recordIntermediate( *sub[run1], subIndex_[run1] ) );
+	}
+
+	for( run1 = 0; run1 < nOut; run1++ )
+		outSlot.push_back( recorder.record( *out[run1] ) );
+
+	allocateBuffer( 0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::clear( ){
+
+	code.clear();
+	constants.clear();
+	constantSlot.clear();
+	inputIndex.clear();
+	inputSlot.clear();
+	subIndex.clear();
+	subSlot.clear();
+	outSlot.clear();
+
+	nSlots     = 0;
+	bufferSize = 0;
+
+	w.clear();
+	dw.clear();
+	aux1.clear();
+	aux2.clear();
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::clearBuffer( ){
+
+	if( bufferSize > 1 ){
+
+		w.resize( nSlots );
+		dw.resize( nSlots );
+		bufferSize = 1;
+	}
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::evaluate( int number, double *x, double *result ){
+
+	int run1;
+
+	if( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	allocateBuffer( number );
+
+	double *v = &w[number*nSlots];
+
+	for( run1 = 0; run1 < (int)inputSlot.size(); run1++ )
+		v[ inputSlot[run1] ] = x[ inputIndex[run1] ];
+
+	for( run1 = 0; run1 < (int)code.size(); run1 += OT_INSTRUCTION_SIZE ){
+
+		const int *c = &code[run1];
+
+		switch( c[0] ){
+
+			case OTC_COPY:        v[c[1]] = v[c[2]];                break;
+			case OTC_ADDITION:    v[c[1]] = v[c[2]] + v[c[3]];      break;
+			case OTC_SUBTRACTION: v[c[1]] = v[c[2]] - v[c[3]];      break;
+			case OTC_PRODUCT:     v[c[1]] = v[c[2]] * v[c[3]];      break;
+			case OTC_QUOTIENT:    v[c[1]] = v[c[2]] / v[c[3]];      break;
+			case OTC_POWER:       v[c[1]] = pow( v[c[2]], v[c[3]] ); break;
+			case OTC_POWER_INT:   v[c[1]] = pow( v[c[2]], c[3] );    break;
+			default:              v[c[1]] = unaryValue( c[0], v[c[2]] );
+		}
+	}
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ )
+		x[ subIndex[run1] ] = v[ subSlot[run1] ];
+
+	for( run1 = 0; run1 < (int)outSlot.size(); run1++ )
+		result[run1] = v[ outSlot[run1] ];
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::AD_forward( int number, double *x, double *seed,
+                                      double *f, double *df ){
+
+	int run1;
+
+	if( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	allocateBuffer( number );
+
+	double *v  = &w [number*nSlots];
+	double *dv = &dw[number*nSlots];
+
+	for( run1 = 0; run1 < (int)inputSlot.size(); run1++ ){
+		v [ inputSlot[run1] ] = x   [ inputIndex[run1] ];
+		dv[ inputSlot[run1] ] = seed[ inputIndex[run1] ];
+	}
+
+	for( run1 = 0; run1 < (int)code.size(); run1 += OT_INSTRUCTION_SIZE ){
+
+		const int *c = &code[run1];
+		const int r = c[1], a = c[2], b = c[3];
+
+		switch( c[0] ){
+
+			case OTC_COPY:
+				v [r] = v [a];
+				dv[r] = dv[a];
+				break;
+
+			case OTC_ADDITION:
+				v [r] = v [a] + v [b];
+				dv[r] = dv[a] + dv[b];
+				break;
+
+			case OTC_SUBTRACTION:
+				v [r] = v [a] - v [b];
+				dv[r] = dv[a] - dv[b];
+				break;
+
+			case OTC_PRODUCT:
+				v [r] = v[a] * v[b];
+				dv[r] = v[b]*dv[a] + v[a]*dv[b];
+				break;
+
+			case OTC_QUOTIENT:
+				v [r] = v[a] / v[b];
+				dv[r] = dv[a]/v[b] - (v[a]*dv[b])/(v[b]*v[b]);
+				break;
+
+			case OTC_POWER:
+				v [r] = pow( v[a],v[b] );
+				dv[r] = v[b]*pow(v[a],v[b]-1.0)*dv[a] + v[r]*log(v[a])*dv[b];
+				break;
+
+			case OTC_POWER_INT:
+				v [r] = pow( v[a],b );
+				dv[r] = b*pow( v[a],b-1 )*dv[a];
+				break;
+
+			default:
+				v [r] = unaryValue( c[0],v[a] );
+				dv[r] = unaryDerivative( c[0],v[a] )*dv[a];
+		}
+	}
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ ){
+		x   [ subIndex[run1] ] = v [ subSlot[run1] ];
+		seed[ subIndex[run1] ] = dv[ subSlot[run1] ];
+	}
+
+	for( run1 = 0; run1 < (int)outSlot.size(); run1++ ){
+		f [run1] = v [ outSlot[run1] ];
+		df[run1] = dv[ outSlot[run1] ];
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::AD_forward( int number, double *seed, double *df ){
+
+	int run1;
+
+	if( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	allocateBuffer( number );
+
+	double *v  = &w [number*nSlots];
+	double *dv = &dw[number*nSlots];
+
+	for( run1 = 0; run1 < (int)inputSlot.size(); run1++ )
+		dv[ inputSlot[run1] ] = seed[ inputIndex[run1] ];
+
+	for( run1 = 0; run1 < (int)code.size(); run1 += OT_INSTRUCTION_SIZE ){
+
+		const int *c = &code[run1];
+		const int r = c[1], a = c[2], b = c[3];
+
+		switch( c[0] ){
+
+			case OTC_COPY:        dv[r] = dv[a];                                  break;
+			case OTC_ADDITION:    dv[r] = dv[a] + dv[b];                          break;
+			case OTC_SUBTRACTION: dv[r] = dv[a] - dv[b];                          break;
+			case OTC_PRODUCT:     dv[r] = v[b]*dv[a] + v[a]*dv[b];                break;
+			case OTC_QUOTIENT:    dv[r] = dv[a]/v[b] - (v[a]*dv[b])/(v[b]*v[b]);  break;
+
+			case OTC_POWER:
+				dv[r] = v[b]*pow(v[a],v[b]-1.0)*dv[a] + v[r]*log(v[a])*dv[b];
+				break;
+
+			case OTC_POWER_INT:   dv[r] = b*pow( v[a],b-1 )*dv[a];                break;
+			default:              dv[r] = unaryDerivative( c[0],v[a] )*dv[a];
+		}
+	}
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ )
+		seed[ subIndex[run1] ] = dv[ subSlot[run1] ];
+
+	for( run1 = 0; run1 < (int)outSlot.size(); run1++ )
+		df[run1] = dv[ outSlot[run1] ];
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::AD_backward( int number, double *seed, double *df ){
+
+	int run1;
+
+	if( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	allocateBuffer( number );
+
+	double *v = &w[number*nSlots];
+	double *l = &aux1[0];
+
+	for( run1 = 0; run1 < nSlots; run1++ )
+		l[run1] = 0.0;
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ )
+		l[ subSlot[run1] ] = df[ subIndex[run1] ];
+
+	for( run1 = 0; run1 < (int)outSlot.size(); run1++ )
+		l[ outSlot[run1] ] += seed[run1];
+
+	for( run1 = (int)code.size() - OT_INSTRUCTION_SIZE; run1 >= 0; run1 -= OT_INSTRUCTION_SIZE ){
+
+		const int *c = &code[run1];
+		const int a = c[2], b = c[3];
+		const double s = l[c[1]];
+
+		switch( c[0] ){
+
+			case OTC_COPY:
+				l[a] += s;
+				break;
+
+			case OTC_ADDITION:
+				l[a] += s;
+				l[b] += s;
+				break;
+
+			case OTC_SUBTRACTION:
+				l[a] += s;
+				l[b] -= s;
+				break;
+
+			case OTC_PRODUCT:
+				l[a] += v[b]*s;
+				l[b] += v[a]*s;
+				break;
+
+			case OTC_QUOTIENT:
+				l[a] += s/v[b];
+				l[b] += -v[a]*s/(v[b]*v[b]);
+				break;
+
+			case OTC_POWER:
+				l[a] += v[b]*pow(v[a],v[b]-1.0)*s;
+				l[b] += pow(v[a],v[b])*log(v[a])*s;
+				break;
+
+			case OTC_POWER_INT:
+				l[a] += b*pow( v[a],b-1 )*s;
+				break;
+
+			default:
+				l[a] += unaryDerivative( c[0],v[a] )*s;
+		}
+	}
+
+	for( run1 = 0; run1 < (int)inputSlot.size(); run1++ )
+		df[ inputIndex[run1] ] += l[ inputSlot[run1] ];
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ )
+		df[ subIndex[run1] ] = l[ subSlot[run1] ];
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::AD_forward2( int number, double *seed1, double *seed2,
+                                       double *df, double *ddf ){
+
+	int run1;
+	double p1, p2, p11, p12, p22;
+
+	if( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	allocateBuffer( number );
+
+	double *dv = &dw[number*nSlots];
+	double *t1 = &aux1[0];
+	double *t2 = &aux2[0];
+
+	for( run1 = 0; run1 < nSlots; run1++ ){
+		t1[run1] = 0.0;
+		t2[run1] = 0.0;
+	}
+
+	for( run1 = 0; run1 < (int)inputSlot.size(); run1++ ){
+		t1[ inputSlot[run1] ] = seed1[ inputIndex[run1] ];
+		t2[ inputSlot[run1] ] = seed2[ inputIndex[run1] ];
+	}
+
+	for( run1 = 0; run1 < (int)code.size(); run1 += OT_INSTRUCTION_SIZE ){
+
+		const int *c = &code[run1];
+		const int r = c[1], a = c[2], b = c[3];
+
+		getPartials( c, &w[number*nSlots], p1, p2, p11, p12, p22 );
+
+		if( isBinaryCode( c[0] ) == true ){
+			t1[r] = p1*t1[a] + p2*t1[b];
+			t2[r] = p1*t2[a] + p2*t2[b]
+			       + p11*t1[a]*dv[a] + p12*( t1[a]*dv[b] + t1[b]*dv[a] ) + p22*t1[b]*dv[b];
+		}
+		else{
+			t1[r] = p1*t1[a];
+			t2[r] = p1*t2[a] + p11*t1[a]*dv[a];
+		}
+	}
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ ){
+		seed1[ subIndex[run1] ] = t1[ subSlot[run1] ];
+		seed2[ subIndex[run1] ] = t2[ subSlot[run1] ];
+	}
+
+	for( run1 = 0; run1 < (int)outSlot.size(); run1++ ){
+		df [run1] = t1[ outSlot[run1] ];
+		ddf[run1] = t2[ outSlot[run1] ];
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTape::AD_backward2( int number, double *seed1, double *seed2,
+                                        double *df, double *ddf ){
+
+	int run1;
+	double p1, p2, p11, p12, p22;
+
+	if( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	allocateBuffer( number );
+
+	double *dv = &dw[number*nSlots];
+	double *l1 = &aux1[0];
+	double *l2 = &aux2[0];
+
+	for( run1 = 0; run1 < nSlots; run1++ ){
+		l1[run1] = 0.0;
+		l2[run1] = 0.0;
+	}
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ ){
+		l1[ subSlot[run1] ] = df [ subIndex[run1] ];
+		l2[ subSlot[run1] ] = ddf[ subIndex[run1] ];
+	}
+
+	for( run1 = 0; run1 < (int)outSlot.size(); run1++ ){
+		l1[ outSlot[run1] ] += seed1[run1];
+		l2[ outSlot[run1] ] += seed2[run1];
+	}
+
+	for( run1 = (int)code.size() - OT_INSTRUCTION_SIZE; run1 >= 0; run1 -= OT_INSTRUCTION_SIZE ){
+
+		const int *c = &code[run1];
+		const int a = c[2], b = c[3];
+		const double s1 = l1[c[1]];
+		const double s2 = l2[c[1]];
+
+		getPartials( c, &w[number*nSlots], p1, p2, p11, p12, p22 );
+
+		if( isBinaryCode( c[0] ) == true ){
+			l1[a] += s1*p1;
+			l2[a] += s2*p1 + s1*( p11*dv[a] + p12*dv[b] );
+			l1[b] += s1*p2;
+			l2[b] += s2*p2 + s1*( p12*dv[a] + p22*dv[b] );
+		}
+		else{
+			l1[a] += s1*p1;
+			l2[a] += s2*p1 + s1*p11*dv[a];
+		}
+	}
+
+	for( run1 = 0; run1 < (int)inputSlot.size(); run1++ ){
+		df [ inputIndex[run1] ] += l1[ inputSlot[run1] ];
+		ddf[ inputIndex[run1] ] += l2[ inputSlot[run1] ];
+	}
+
+	for( run1 = 0; run1 < (int)subSlot.size(); run1++ ){
+		df [ subIndex[run1] ] = l1[ subSlot[run1] ];
+		ddf[ subIndex[run1] ] = l2[ subSlot[run1] ];
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType OperatorTape::isEmpty( ) const{
+
+	if( nSlots == 0 && outSlot.empty() == true )
+		return BT_TRUE;
+
+	return BT_FALSE;
+}
+
+
+int OperatorTape::getNumberOfInstructions( ) const{
+
+	return (int)code.size() / OT_INSTRUCTION_SIZE;
+}
+
+
+int OperatorTape::getNumberOfSlots( ) const{
+
+	return nSlots;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void OperatorTape::allocateBuffer( int number ){
+
+	int run1, run2;
+
+	if( number < bufferSize )
+		return;
+
+	w.resize( (number+1)*nSlots, 0.0 );
+	dw.resize( (number+1)*nSlots, 0.0 );
+	aux1.resize( nSlots > 0 ? nSlots : 1 );
+	aux2.resize( nSlots > 0 ? nSlots : 1 );
+
+	// constants are never written by the tape, so they are set only once per buffer
+	for( run1 = bufferSize; run1 <= number; run1++ )
+		for( run2 = 0; run2 < (int)constantSlot.size(); run2++ )
+			w[run1*nSlots + constantSlot[run2]] = constants[run2];
+
+	bufferSize = number+1;
+}
+
+
+void OperatorTape::getPartials( const int *instr, const double *v,
+                                double &p1, double &p2,
+                                double &p11, double &p12, double &p22 ) const{
+
+	const double x = v[ instr[2] ];
+	const double y = isBinaryCode( instr[0] ) == true ? v[ instr[3] ] : 0.0;
+
+	double nn1, nn2, nn3;
+	int e;
+
+	p1 = p2 = p11 = p12 = p22 = 0.0;
+
+	switch( instr[0] ){
+
+		case OTC_COPY:
+			p1 = 1.0;
+			break;
+
+		case OTC_ADDITION:
+			p1 = 1.0;
+			p2 = 1.0;
+			break;
+
+		case OTC_SUBTRACTION:
+			p1 =  1.0;
+			p2 = -1.0;
+			break;
+
+		case OTC_PRODUCT:
+			p1  = y;
+			p2  = x;
+			p12 = 1.0;
+			break;
+
+		case OTC_QUOTIENT:
+			p1  =  1.0/y;
+			p2  = -x/(y*y);
+			p12 = -1.0/(y*y);
+			p22 =  2.0*x/(y*y*y);
+			break;
+
+		case OTC_POWER:
+			nn1 = pow( x, y     );
+			nn2 = pow( x, y-1.0 );
+			nn3 = log( x );
+			p1  = nn2*y;
+			p2  = nn1*nn3;
+			p11 = y*(y-1.0)*pow( x, y-2.0 );
+			p12 = nn2*(y*nn3 + 1.0);
+			p22 = nn1*nn3*nn3;
+			break;
+
+		case OTC_POWER_INT:
+			e   = instr[3];
+			p1  = e*pow( x,e-1 );
+			p11 = e*(e-1)*pow( x,e-2 );
+			break;
+
+		default:
+			p1  = unaryDerivative( instr[0],x );
+			p11 = unarySecondDerivative( instr[0],x );
+	}
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,247 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/symbolic_operator/operator_tape.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_TAPE_HPP
+#define ACADO_TOOLKIT_OPERATOR_TAPE_HPP
+
+
+#include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Instruction codes of an OperatorTape. */
+enum OperatorTapeCode{
+
+    OTC_COPY,
+    OTC_ADDITION,
+    OTC_SUBTRACTION,
+    OTC_PRODUCT,
+    OTC_QUOTIENT,
+    OTC_POWER,
+    OTC_POWER_INT,
+    OTC_SIN,
+    OTC_COS,
+    OTC_TAN,
+    OTC_ASIN,
+    OTC_ACOS,
+    OTC_ATAN,
+    OTC_EXP,
+    OTC_LOGARITHM
+};
+
+
+/**
+ *	\brief Flat instruction tape compiled from a DAG of symbolic operators.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class OperatorTape linearises the intermediate expressions and the
+ *  output expressions of a FunctionEvaluationTree into one contiguous
+ *  array of instructions. Every instruction consists of an opcode, a
+ *  result slot and two operand slots; all slots live in one workspace
+ *  vector. The tape is interpreted in a tight loop and offers the same
+ *  evaluation and automatic differentiation routines as the tree walker,
+ *  including the buffered variants that are indexed by a storage position.
+ *
+ *  Only purely symbolic trees can be compiled: C functions (COperator)
+ *  cannot be recorded and make the compilation fail.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+class OperatorTape{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    OperatorTape( );
+
+    /** Copy constructor (deep copy). */
+    OperatorTape( const OperatorTape& arg );
+
+    /** Destructor. */
+    ~OperatorTape( );
+
+    /** Assignment operator (deep copy). */
+    OperatorTape& operator=( const OperatorTape& arg );
+
+
+    /** Records the intermediate and output expressions on the tape.   \n
+     *  Intermediate expressions must be given in evaluation order.   \n
+     *                                                                 \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS              \n
+     */
+    returnValue compile( int         nSub      /**< number of intermediate expressions */,
+                         Operator  **sub       /**< the intermediate expressions       */,
+                         const int  *subIndex  /**< their global variable indices      */,
+                         int         nOut      /**< number of output expressions       */,
+                         Operator  **out       /**< the output expressions             */ );
+
+    /** Removes all instructions from the tape. */
+    returnValue clear( );
+
+    /** Clears the evaluation buffers and resets their size to 1. */
+    returnValue clearBuffer( );
+
+
+    /** Evaluates the tape and stores the intermediate results in a   \n
+     *  buffer (needed for automatic differentiation in backward     \n
+     *  mode).                                                        \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     */
+    returnValue evaluate( int     number    /**< storage position     */,
+                          double *x         /**< the input variable x */,
+                          double *result    /**< the result           */  );
+
+
+    /** Automatic Differentiation in forward mode.                \n
+     *  This function stores the intermediate                     \n
+     *  results in a buffer.                                      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int     number  /**< storage position */,
+                            double *x       /**< the evaluation point x */,
+                            double *seed    /**< the seed         */,
+                            double *f       /**< the value of the
+                                                 expression at x  */,
+                            double *df      /**< the derivative of
+                                                 the expression   */  );
+
+    /** Automatic Differentiation in forward mode.                \n
+     *  This function uses the intermediate                       \n
+     *  results from a buffer.                                    \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int     number  /**< storage position */,
+                            double *seed    /**< the seed         */,
+                            double *df      /**< the derivative of
+                                                 the expression   */  );
+
+    /** Automatic Differentiation in backward mode based on       \n
+     *  buffered values.                                          \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+    returnValue AD_backward( int     number /**< the buffer position */,
+                             double *seed   /**< the seed            */,
+                             double *df     /**< the derivative of
+                                                 the expression      */ );
+
+    /** Automatic Differentiation in forward mode for             \n
+     *  2nd derivatives based on buffered values.                 \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+    returnValue AD_forward2( int     number  /**< the buffer position */,
+                             double *seed1   /**< the seed            */,
+                             double *seed2   /**< the seed for the
+                                                  first derivative    */,
+                             double *df      /**< the derivative of
+                                                  the expression      */,
+                             double *ddf     /**< the 2nd derivative
+                                                  of the expression   */ );
+
+    /** Automatic Differentiation in backward mode for 2nd order  \n
+     *  derivatives based on buffered values.                     \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+    returnValue AD_backward2( int     number /**< the buffer position */,
+                              double *seed1  /**< the seed1           */,
+                              double *seed2  /**< the seed2           */,
+                              double *df     /**< the 1st derivative
+                                                  of the expression   */,
+                              double *ddf    /**< the 2nd derivative
+                                                  of the expression   */ );
+
+
+    /** Returns whether the tape holds a compiled function. */
+    BooleanType isEmpty( ) const;
+
+    /** Returns the number of recorded instructions. */
+    int getNumberOfInstructions( ) const;
+
+    /** Returns the number of workspace slots of one buffer. */
+    int getNumberOfSlots( ) const;
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Makes sure that the buffers can hold the storage position number. */
+    void allocateBuffer( int number );
+
+    /** Computes the first and second order partial derivatives of the  \n
+     *  instruction instr w.r.t. its operands at the values v.          \n
+     */
+    void getPartials( const int *instr, const double *v,
+                      double &p1, double &p2,
+                      double &p11, double &p12, double &p22 ) const;
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    std::vector< int >     code;            /**< The instructions, stored as
+                                              *  (opcode, result, operand1, operand2). */
+    std::vector< double >  constants;       /**< Values of all constant slots.        */
+    std::vector< int >     constantSlot;    /**< Workspace slots of the constants.    */
+
+    std::vector< int >     inputIndex;      /**< Global variable indices read by the tape. */
+    std::vector< int >     inputSlot;       /**< Their workspace slots.                   */
+    std::vector< int >     subIndex;        /**< Global indices of the intermediate states. */
+    std::vector< int >     subSlot;         /**< Their workspace slots.                     */
+    std::vector< int >     outSlot;         /**< Workspace slots of the outputs.            */
+
+    int                    nSlots;          /**< Number of workspace slots per buffer.  */
+    int                    bufferSize;      /**< Number of allocated buffers.           */
+
+    std::vector< double >  w;               /**< Buffered values (bufferSize x nSlots).      */
+    std::vector< double >  dw;              /**< Buffered first order derivatives.           */
+    std::vector< double >  aux1;            /**< Workspace for seeds and adjoints.           */
+    std::vector< double >  aux2;            /**< Workspace for 2nd order seeds and adjoints. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_OPERATOR_TAPE_HPP
+
+// end of file.
@@ -109,17 +109,16 @@ Power_Int::Power_Int( const Power_Int &arg ){
 
 Power_Int::~Power_Int(){
 
- delete argument;
-//     if( argument != 0 ){
-// 
-//         if( argument->nCount == 0 ){
-//             delete argument;
-//             argument = 0;
-//         }
-//         else{
-//             argument->nCount--;
-//         }
-//     }
+    if( argument != 0 ){
+
+        if( argument->nCount == 0 ){
+            delete argument;
+            argument = 0;
+        }
+        else{
+            argument->nCount--;
+        }
+    }
 
     if( dargument != NULL ){
         delete dargument;
@@ -143,17 +142,16 @@ Power_Int& Power_Int::operator=( const Power_Int &arg ){
     if( this != &arg ){
 
 	 
-	 delete argument;
-//         if( argument != 0 ){
-// 
-//             if( argument->nCount == 0 ){
-//                 delete argument;
-//                 argument = 0;
-//             }
-//             else{
-//                 argument->nCount--;
-//             }
-//         }
+        if( argument != 0 ){
+
+            if( argument->nCount == 0 ){
+                delete argument;
+                argument = 0;
+            }
+            else{
+                argument->nCount--;
+            }
+        }
 
         if( dargument != NULL ){
             delete dargument;
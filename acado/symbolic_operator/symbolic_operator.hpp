@@ -37,6 +37,7 @@
     #include <acado/symbolic_operator/evaluation_base.hpp>
     #include <acado/symbolic_operator/evaluation_template.hpp>
     
+    #include <acado/symbolic_operator/operator_arena.hpp>
     #include <acado/symbolic_operator/operator.hpp>
     #include <acado/symbolic_operator/smooth_operator.hpp>
 	#include <acado/symbolic_operator/nonsmooth_operator.hpp>
@@ -62,6 +63,9 @@
     #include <acado/symbolic_operator/tan.hpp>
     #include <acado/symbolic_operator/projection.hpp>
     #include <acado/symbolic_operator/tree_projection.hpp>
+    #include <acado/symbolic_operator/operator_tape.hpp>
+    #include <acado/symbolic_operator/operator_store.hpp>
+    #include <acado/symbolic_operator/operator_cse.hpp>
 
 
     // -------------------------------------------------------
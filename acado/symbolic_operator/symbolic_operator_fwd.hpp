@@ -71,6 +71,8 @@ BEGIN_NAMESPACE_ACADO
    class DoubleConstant              ;
    class Projection                  ;
    class TreeProjection              ;
+   class OperatorStore               ;
+   class OperatorCSE                 ;
 
 
 CLOSE_NAMESPACE_ACADO
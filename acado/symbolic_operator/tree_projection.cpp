@@ -114,9 +114,8 @@ Operator& TreeProjection::operator=( const Operator &arg ){
             }
         }
 
-    	Operator *arg_tmp = arg.clone();
-    	TreeProjection *tp = dynamic_cast<TreeProjection *>(arg_tmp);
-    	Projection *p = dynamic_cast<Projection *>(arg_tmp);
+    	const TreeProjection *tp = dynamic_cast<const TreeProjection *>(&arg);
+    	const Projection *p = dynamic_cast<const Projection *>(&arg);
     	if( tp != 0 ) {
     		// special case: argument is a treeprojection
     		if( tp->argument != 0 ) {
@@ -152,7 +151,6 @@ Operator& TreeProjection::operator=( const Operator &arg ){
     				scale = argument->getValue();
     		}
     	}
-    	delete arg_tmp;
     }
 
     return *this;
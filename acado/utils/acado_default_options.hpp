@@ -70,6 +70,7 @@ const int 		defaultprintSCPmethodProfile = BT_FALSE;							/**< Default value fo
 
 // DynamicDiscretization
 const int 		defaultFreezeIntegrator = BT_TRUE;							/**< Default value for specifying whether integrator should freeze all intermediate results (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultNumIntegratorThreads = 1;							/**< Default value for the number of threads integrating the shooting intervals concurrently (possible values: any positive integer). */
 const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_BDF). */
 const int 		defaultFeasibilityCheck = BT_FALSE;							/**< Default value for specifying whether infeasibilty shall be checked (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPlotResoltion = LOW;									/**< Default value for specifying the plot resolution (possible values: HIGH, MEDIUM, LOW). */
@@ -85,6 +86,9 @@ const double 	defaultStepsizeTuning = 0.5;								/**< Default value for the fac
 const double 	defaultCorrectorTolerance = 1.0e-14;						/**< Default value for the corrector tolerance of implicit integrators (possible values: any positive real number). */
 const int 		defaultIntegratorPrintlevel = LOW;							/**< Default value for for the printlevel determining the quatity of output given by the integrator (possible values: HIGH, MEDIUM, LOW, NONE). */
 const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default value for specifying how the linear systems are solved within the integrator (possible values: HOUSEHOLDER_METHOD, SPARSE_LU). */
+const double	defaultJacobianUpdateConvergenceRate = 0.33;				/**< Default value for the contraction rate of the Newton iteration above which the Jacobian is re-evaluated (possible values: any positive real smaller than one). */
+const double	defaultJacobianUpdateStepsizeRatio = 0.0;					/**< Default value for the relative change of the BDF coefficient above which the Jacobian is re-evaluated (possible values: any non-negative real number, 0 disables the check). */
+const int 		defaultJacobianUpdateMaxSteps = 0;							/**< Default value for the maximum number of BDF steps between two Jacobian evaluations (possible values: any non-negative integer, 0 disables the check). */
 const int 		defaultAlgebraicRelaxation = ART_ADAPTIVE_POLYNOMIAL;		/**< Default value for specifying how algebraic equations are relaxed within the integrator (possible values: ART_EXPONENTIAL, ART_ADAPTIVE_POLYNOMIAL). */
 const double	defaultRelaxationParameter = 0.5;							/**< Default value for the amount algebraic equations are relaxed within the integrator (possible values: any positive real number). */
 const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value for specifying whether a runtime profile of the integrator shall be printed (possible values: BT_TRUE, BT_FALSE). */
@@ -93,6 +97,7 @@ const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value
 const int 		defaultParetoFrontDiscretization = 21;						/**< Default value for the number of points of the pareto front (possible values: any postive integer). */
 const int 		defaultParetoFrontGeneration = PFG_WEIGHTED_SUM;			/**< Default value for specifying the scalarization method (possible values: PFG_FIRST_OBJECTIVE, PFG_SECOND_OBJECTIVE, PFG_WEIGHTED_SUM, PFG_NORMALIZED_NORMAL_CONSTRAINT, PFG_NORMAL_BOUNDARY_INTERSECTION, PFG_ENHANCED_NORMALIZED_NORMAL_CONSTRAINT, PFG_EPSILON_CONSTRAINT). */
 const int 		defaultParetoFrontHotstart = BT_TRUE;						/**< Default value for specifying whether hotstarts are to be used within the multi-objective optimization (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultParetoFrontNumThreads = 1;							/**< Default value for the number of threads solving the subproblems of the Pareto front concurrently (possible values: any positive integer). */
 
 // SimulationEnvironment
 const int 		defaultSimulateComputationalDelay = BT_FALSE;				/**< Default value for specifying whether computational delays shall be simulated or not (possible values: BT_TRUE, BT_FALSE). */
@@ -0,0 +1,218 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file src/utils/acado_thread_pool.cpp
+*    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+*/
+
+
+#include <acado/utils/acado_thread_pool.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+ThreadPool::ThreadPool( )
+{
+	nThreads = 1;
+
+	currentTask = 0;
+	numTasks = 0;
+	nextTask = 0;
+	numBusyWorkers = 0;
+	batchCounter = 0;
+	stopping = false;
+}
+
+
+ThreadPool::ThreadPool( int _nThreads )
+{
+	nThreads = 1;
+
+	currentTask = 0;
+	numTasks = 0;
+	nextTask = 0;
+	numBusyWorkers = 0;
+	batchCounter = 0;
+	stopping = false;
+
+	init( _nThreads );
+}
+
+
+ThreadPool::ThreadPool( const ThreadPool &rhs )
+{
+	nThreads = 1;
+
+	currentTask = 0;
+	numTasks = 0;
+	nextTask = 0;
+	numBusyWorkers = 0;
+	batchCounter = 0;
+	stopping = false;
+
+	init( rhs.nThreads );
+}
+
+
+ThreadPool::~ThreadPool( )
+{
+	stop( );
+}
+
+
+ThreadPool& ThreadPool::operator=( const ThreadPool &rhs )
+{
+	if ( this != &rhs )
+		init( rhs.nThreads );
+
+	return *this;
+}
+
+
+
+returnValue ThreadPool::init( int _nThreads )
+{
+	if ( _nThreads < 1 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	if ( _nThreads == nThreads )
+		return SUCCESSFUL_RETURN;
+
+	stop( );
+
+	nThreads = _nThreads;
+	stopping = false;
+
+	for( int i = 1; i < nThreads; ++i )
+		workers.push_back( std::thread( &ThreadPool::work, this, batchCounter ) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+int ThreadPool::getNumThreads( ) const
+{
+	return nThreads;
+}
+
+
+returnValue ThreadPool::run(	int nTasks,
+								const std::function< void( int ) >& task
+								)
+{
+	if ( workers.empty( ) == true || nTasks <= 1 )
+	{
+		for( int i = 0; i < nTasks; ++i )
+			task( i );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	std::unique_lock< std::mutex > lock( mutex );
+
+	currentTask = &task;
+	numTasks = nTasks;
+	nextTask = 0;
+	numBusyWorkers = (int)workers.size( );
+	++batchCounter;
+
+	lock.unlock( );
+	batchStarted.notify_all( );
+
+	runTasks( );
+
+	lock.lock( );
+	batchFinished.wait( lock, [this]{ return numBusyWorkers == 0; } );
+
+	currentTask = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void ThreadPool::stop( )
+{
+	{
+		std::lock_guard< std::mutex > lock( mutex );
+		stopping = true;
+	}
+	batchStarted.notify_all( );
+
+	for( unsigned i = 0; i < workers.size( ); ++i )
+		workers[ i ].join( );
+
+	workers.clear( );
+	nThreads = 1;
+}
+
+
+void ThreadPool::work( unsigned lastBatch )
+{
+	std::unique_lock< std::mutex > lock( mutex );
+
+	while( true )
+	{
+		batchStarted.wait( lock, [&]{ return stopping == true || batchCounter != lastBatch; } );
+
+		if ( stopping == true )
+			return;
+
+		lastBatch = batchCounter;
+
+		lock.unlock( );
+		runTasks( );
+		lock.lock( );
+
+		if ( --numBusyWorkers == 0 )
+			batchFinished.notify_all( );
+	}
+}
+
+
+void ThreadPool::runTasks( )
+{
+	int i;
+
+	while( ( i = nextTask++ ) < numTasks )
+		( *currentTask )( i );
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,181 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file include/acado/utils/acado_thread_pool.hpp
+*    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+*/
+
+
+#ifndef ACADO_TOOLKIT_ACADO_THREAD_POOL_HPP
+#define ACADO_TOOLKIT_ACADO_THREAD_POOL_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Runs independent tasks concurrently on a fixed set of threads.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class ThreadPool keeps a number of worker threads alive, so that
+ *	loops over independent tasks (e.g. the integration of all shooting
+ *	intervals) can be run concurrently without creating threads in each
+ *	call. The calling thread takes part in the work, i.e. a pool for n
+ *	threads starts n-1 worker threads. A pool for a single thread runs
+ *	all tasks sequentially in the calling thread.
+ *
+ *	The tasks are handed out in increasing order; as the tasks themselves
+ *	are run concurrently, results have to be stored per task and assembled
+ *	by the caller afterwards.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ */
+class ThreadPool
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Default constructor, which runs all tasks in the calling thread.
+		 */
+		ThreadPool( );
+
+		/** Constructor which takes the number of threads.
+		 *
+		 *	@param[in] _nThreads	Number of threads, including the calling thread.
+		 */
+		ThreadPool(	int _nThreads
+					);
+
+		/** Copy constructor, which starts its own threads.
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		ThreadPool(	const ThreadPool &rhs
+					);
+
+		/** Destructor, which stops all threads.
+		 */
+		~ThreadPool( );
+
+		/** Assignment operator, which starts its own threads.
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		ThreadPool& operator=(	const ThreadPool &rhs
+								);
+
+
+		/** (Re-)starts the pool with the given number of threads; nothing
+		 *	is done if the number of threads does not change.
+		 *
+		 *	@param[in] _nThreads	Number of threads, including the calling thread.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue init(	int _nThreads
+							);
+
+		/** Returns the number of threads, including the calling thread.
+		 */
+		int getNumThreads( ) const;
+
+		/** Calls task( i ) for i = 0,...,nTasks-1 on all threads of the pool
+		 *	and returns when all tasks are done.
+		 *
+		 *	@param[in] nTasks	Number of tasks.
+		 *	@param[in] task		Function which runs a single task.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue run(	int nTasks,
+							const std::function< void( int ) >& task
+							);
+
+
+	//
+	//  PROTECTED MEMBER FUNCTIONS:
+	//
+	protected:
+
+		/** Stops and joins all worker threads.
+		 */
+		void stop( );
+
+		/** Main loop of a worker thread, which waits for the batches
+		 *	started after the given one.
+		 */
+		void work(	unsigned lastBatch
+					);
+
+		/** Runs tasks of the current batch until all have been handed out.
+		 */
+		void runTasks( );
+
+
+	//
+	//  PROTECTED MEMBERS:
+	//
+	protected:
+
+		int nThreads;										/**< Number of threads, including the calling thread. */
+		std::vector< std::thread > workers;					/**< Worker threads. */
+
+		std::mutex mutex;									/**< Protects the batch data below. */
+		std::condition_variable batchStarted;				/**< Signals a new batch or the stop of the pool. */
+		std::condition_variable batchFinished;				/**< Signals that all workers are done with a batch. */
+
+		const std::function< void( int ) >* currentTask;	/**< Task of the current batch. */
+		int numTasks;										/**< Number of tasks of the current batch. */
+		std::atomic< int > nextTask;						/**< Next task to be handed out. */
+		int numBusyWorkers;									/**< Number of workers still running the current batch. */
+		unsigned batchCounter;								/**< Number of batches started so far. */
+		bool stopping;										/**< Whether the workers have to stop. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif	// ACADO_TOOLKIT_ACADO_THREAD_POOL_HPP
+
+/*
+ *	end of file
+ */
@@ -111,6 +111,14 @@ enum VariableType{
 };
 
 
+/** Defines the ways in which a FunctionEvaluationTree is evaluated numerically. */
+enum FunctionEvaluationMode{
+
+    FEM_TREE,			/**< Recursive evaluation of the operator trees. */
+    FEM_TAPE			/**< Interpretation of a flat instruction tape compiled from the operator trees. */
+};
+
+
 /** Defines all possible methods of merging variables grids in case a grid point 
  *	exists in both grids. */
 enum MergeMethod
@@ -339,12 +347,20 @@ enum OptionsName
 	CG_USE_C99,									/**< Code generation is allowed (or not) to export C-code that conforms C99 standard. */
 	CG_COMPUTE_COVARIANCE_MATRIX,				/**< Enable computation of the variance-covariance matrix for the last estimate. */
 	CG_HARDCODE_CONSTRAINT_VALUES,				/**< Enable/disable hard-coding of the constraint values. */
+	CG_USE_BATCHED_EVALUATION,					/**< Evaluate the objective and the path constraints on all shooting nodes at once, by a batched function. */
+	CG_USE_REENTRANT_CODE,						/**< Keep all data of the exported solver in a context structure, which is passed to all exported functions, instead of global variables. */
+	CG_USE_BLOCKED_LINEAR_ALGEBRA,				/**< Export larger matrix multiplications as register-blocked, cache-tiled kernels instead of unrolled code or plain loops. */
+	CG_UNROLLING_BUDGET,						/**< Maximum number of unrolled scalar statements per exported function, further operations are exported as loops (0: no limit). */
+	CG_CODE_SIZE_BUDGET,						/**< Maximum size of the exported solver code in bytes, the unrolling budget is reduced until it fits (0: no limit). */
+	CG_HESSIAN_REGULARIZATION,					/**< Regularization of the exact Hessian in exported RTI solvers. \sa HessianRegularizationMode */
+	CG_USE_PROFILING,							/**< Time the phases of the exported RTI steps and collect their statistics, see the profiling functions of the auxiliary functions. */
+	CG_USE_MIXED_PRECISION,						/**< Evaluate the model sensitivities in single precision, while the states, the condensing, the factorizations and the QP are kept in real_t. */
 	IMPLICIT_INTEGRATOR_MODE,					/**< This determines the mode of the implicit integrator (see enum ImplicitIntegratorMode). */
 	LIFTED_INTEGRATOR_MODE,						/**< This determines the mode of lifting of the implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS,				/**< This is the performed number of Newton iterations in the implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS_INIT,			/**< This is the performed number of Newton iterations in the implicit integrator for the initialization of the first step. */
 	UNROLL_LINEAR_SOLVER,						/**< This option of the boolean type determines the unrolling of the linear solver (no unrolling recommended for larger systems). */
-	CONDENSING_BLOCK_SIZE,						/**< Defines the block size used in a block based condensing approach for code generated RTI. */
+	CONDENSING_BLOCK_SIZE,						/**< Defines the block size used in a block based condensing approach for code generated RTI, zero selects it automatically. */
 	INTEGRATOR_DEBUG_MODE,
 	OPT_UNKNOWN,
 	MAX_NUM_INTEGRATOR_STEPS,
@@ -360,6 +376,9 @@ enum OptionsName
 	CORRECTOR_TOLERANCE,
 	INTEGRATOR_PRINTLEVEL,
 	LINEAR_ALGEBRA_SOLVER,
+	JACOBIAN_UPDATE_CONVERGENCE_RATE,			/**< Contraction rate of the Newton iteration above which the BDF integrator re-evaluates the Jacobian. */
+	JACOBIAN_UPDATE_STEPSIZE_RATIO,				/**< Relative change of the BDF coefficient (i.e. of the stepsize) since the last Jacobian evaluation above which the Jacobian is re-evaluated (0: never). */
+	JACOBIAN_UPDATE_MAX_STEPS,					/**< Maximum number of BDF steps between two Jacobian evaluations (0: no limit). */
 	ALGEBRAIC_RELAXATION,
 	RELAXATION_PARAMETER,
 	PRINT_INTEGRATOR_PROFILE,
@@ -390,6 +409,7 @@ enum OptionsName
 	TERMINATE_AT_CONVERGENCE,
 	USE_REFERENCE_PREDICTION,
 	FREEZE_INTEGRATOR,
+	NUM_INTEGRATOR_THREADS,
 	INTEGRATOR_TYPE,
 	MEASUREMENT_GRID,
 	SAMPLING_TIME,
@@ -399,6 +419,7 @@ enum OptionsName
 	PARETO_FRONT_DISCRETIZATION,
 	PARETO_FRONT_GENERATION,
 	PARETO_FRONT_HOTSTART,
+	PARETO_FRONT_NUM_THREADS,					/**< Number of threads solving the subproblems of the Pareto front concurrently. */
 	SIMULATION_ALGORITHM,
 	CONTROL_PLOTTING,
 	PARAMETER_PLOTTING,
@@ -487,7 +508,9 @@ enum LogName
     LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS,
     LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,
 	// 50
-    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION
+    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,
+    LOG_NUMBER_OF_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITIONS,
+    LOG_NUMBER_OF_BDF_INTEGRATOR_NEWTON_ITERATIONS
 };
 
 
@@ -746,7 +769,8 @@ enum SparseQPsolutionMethods
 	FULL_CONDENSING_N2,
 	CONDENSING_N2,
 	BLOCK_CONDENSING_N2,
-	FULL_CONDENSING_N2_FACTORIZATION
+	FULL_CONDENSING_N2_FACTORIZATION,
+	SPARSE_RICCATI					/**< Sparse QP, solved by an exported interior point method with Riccati recursion. */
 };
 
 
@@ -782,7 +806,8 @@ enum ExportType
 	REAL,
 	COMPLEX,
 	STATIC_CONST_INT,
-	STATIC_CONST_REAL
+	STATIC_CONST_REAL,
+	REAL_SINGLE
 };
 
 enum ExportStruct
@@ -805,6 +830,14 @@ enum CondensedHessianCholeskyDecomposition
 	INTERNAL_N2		/**< n-square version, performed within the exported code, and passed to a QP solver. */
 };
 
+/** Regularization of the exact Hessian in exported RTI solvers. */
+enum HessianRegularizationMode
+{
+	REGULARIZE_MIRROR_EVD,			/**< Mirror the negative eigenvalues of every stage Hessian block, based on its eigenvalue decomposition. */
+	REGULARIZE_MODIFIED_CHOLESKY,	/**< Modified LDL' factorization of every stage Hessian block, the diagonal is perturbed where the block is not sufficiently positive definite. */
+	REGULARIZE_RICCATI				/**< Modified LDL' factorization of the reduced control Hessians of a backward Riccati sweep, the stage blocks need not be positive definite. */
+};
+
 /**
  *	\brief Defines all symbols for global return values.
  *
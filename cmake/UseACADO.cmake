@@ -21,6 +21,8 @@ MACRO( ACADO_GENERATE_COMPILE generator exportFolder testFile )
 	# exportFolder: export folder name. At the moment, only relative folder
 	#               names are supported
 	# testFile:     C/C++ source name of a test file
+	# ...:          optional names of further exported sources, e.g.
+	#               acado_hessian_regularization.c of exact Hessian solvers
 	
 	# NOTE: works only with qpOASES based OCP solvers
 	
@@ -38,6 +40,10 @@ MACRO( ACADO_GENERATE_COMPILE generator exportFolder testFile )
 			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_auxiliary_functions.c
 		)
 		
+		FOREACH( EXTRA_FILE ${ARGN} )
+			LIST( APPEND ${generator}_GENERATED_FILES ${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/${EXTRA_FILE} )
+		ENDFOREACH( EXTRA_FILE ${ARGN} )
+		
 		# Get the full name of the executable getting_started
 		GET_TARGET_PROPERTY(
 			${generator}_EXE
@@ -110,6 +116,91 @@ MACRO( ACADO_GENERATE_COMPILE generator exportFolder testFile )
 	
 ENDMACRO()
 
+MACRO( ACADO_GENERATE_COMPILE_RICCATI generator exportFolder testFile )
+	# generator:    target used for code generation
+	# exportFolder: export folder name. At the moment, only relative folder
+	#               names are supported
+	# testFile:     C/C++ source name of a test file
+	
+	# NOTE: works only with OCP solvers using the exported Riccati based QP
+	#       solver, i.e. SPARSE_QP_SOLUTION set to SPARSE_RICCATI
+	
+	IF (NOT ("${CMAKE_VERSION}" VERSION_LESS "2.8.10"))
+
+		SET( ${generator}_GENERATED_FILES
+			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_common.h
+			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_solver.c
+			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_integrator.c
+			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_riccati_qp_solver.c
+			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_auxiliary_functions.h
+			${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}/acado_auxiliary_functions.c
+		)
+		
+		GET_TARGET_PROPERTY(
+			${generator}_EXE
+				${generator} LOCATION
+		)
+		
+		ADD_CUSTOM_COMMAND(
+			OUTPUT
+				${${generator}_GENERATED_FILES}       
+			COMMAND
+				${${generator}_EXE}
+			WORKING_DIRECTORY
+				${CMAKE_CURRENT_SOURCE_DIR}
+			DEPENDS
+				${generator}
+		)
+		
+		GET_FILENAME_COMPONENT( EXEC_NAME ${testFile} NAME_WE )
+		ADD_EXECUTABLE(
+			${EXEC_NAME}
+			${testFile}
+			${${generator}_GENERATED_FILES}
+		)
+
+		TARGET_LINK_LIBRARIES(
+			${EXEC_NAME}
+			m
+		)
+		IF( ${CMAKE_SYSTEM_NAME} MATCHES "Linux" )
+			TARGET_LINK_LIBRARIES(
+				${EXEC_NAME}
+				rt
+			)
+		ENDIF( ${CMAKE_SYSTEM_NAME} MATCHES "Linux" )
+		
+		SET_TARGET_PROPERTIES(
+			${EXEC_NAME}
+			PROPERTIES
+				RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
+		)
+		
+		SET_PROPERTY(
+			TARGET
+				${EXEC_NAME}
+			PROPERTY
+				INCLUDE_DIRECTORIES ${CMAKE_CURRENT_SOURCE_DIR}/${exportFolder}
+		)
+		
+		IF ( ACADO_WITH_TESTING )
+			ADD_TEST(
+				NAME
+					${EXEC_NAME}_test
+				WORKING_DIRECTORY
+					"${CMAKE_CURRENT_SOURCE_DIR}"
+				COMMAND
+					${EXEC_NAME}
+			)
+		ENDIF()
+		
+	ELSE(NOT ("${CMAKE_VERSION}" VERSION_LESS "2.8.10"))
+		MESSAGE( WARNING "Your CMake is old, thus we cannot generate and compile the code with a macro -- i.e. you have to do it by hand.")
+	
+	ENDIF (NOT ("${CMAKE_VERSION}" VERSION_LESS "2.8.10"))
+	
+ENDMACRO()
+
 MACRO( ACADO_APPLICATION name )
 	# name: Name of the application (target)
 	# NOTE: All other arguments are considered as source files
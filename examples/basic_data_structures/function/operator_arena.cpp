@@ -0,0 +1,78 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/basic_data_structures/function/operator_arena.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ *    \date 2014
+ *
+ *    Builds a chain of N coupled nonlinear expressions and computes its
+ *    Jacobian and a row of its Hessian symbolically within an
+ *    OperatorArena, and prints the operator counters and the run time.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+USING_NAMESPACE_ACADO
+
+
+const int N = 60;    // number of expressions
+
+
+int main( ){
+
+    DifferentialState x("", N, 1);
+    Control           u;
+
+    printf( "operators before       : %d (%ld bytes)\n",
+            OperatorArena::getTotalNumberOfNodes(), OperatorArena::getTotalNumberOfBytes() );
+
+    double tic = acadoGetTime();
+    {
+        // all operators created in this scope are placed into the arena:
+        OperatorArena arena;
+
+        Expression f;
+        for( int i = 0; i < N; i++ )
+            f << sin( x(i) )*x((i+1)%N) + exp( -x((i+2)%N)*u )/( 1.0 + x(i)*x(i) );
+
+        Expression J = jacobian( f, x );
+        Expression H = jacobian( J.getRow(0).transpose(), x );
+
+        printf( "operators in the arena : %d (%ld bytes, %ld bytes reserved)\n",
+                arena.getNumberOfNodes(), arena.getNumberOfBytes(), arena.getNumberOfReservedBytes() );
+    }
+    double toc = acadoGetTime() - tic;
+
+    // the arena has released its memory with the last of its operators:
+    printf( "operators after        : %d (%ld bytes)\n",
+            OperatorArena::getTotalNumberOfNodes(), OperatorArena::getTotalNumberOfBytes() );
+    printf( "run time               : %.3e s\n", toc );
+
+    return 0;
+}
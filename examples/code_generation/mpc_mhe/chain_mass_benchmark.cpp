@@ -0,0 +1,183 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file   examples/code_generation/chain_mass_benchmark.cpp
+ *    \author Milan Vukov
+ *    \date   2014
+ *
+ *    NMPC of a chain of 15 masses (30 states), which is exported with the
+ *    blocked multiplication kernels (chain_mass_benchmark_export) and with
+ *    plain loops (chain_mass_benchmark_loops_export). Reports the size of
+ *    the generated code, see chain_mass_benchmark_test.cpp for the timings.
+ *
+ *    In addition, a long horizon (N = 50) with full condensing and plain
+ *    loops is exported without and with a code size budget of 200 kB for
+ *    acado_solver.c, and the size of each exported function is reported.
+ */
+
+#include <acado_code_generation.hpp>
+
+#include <fstream>
+
+USING_NAMESPACE_ACADO
+
+
+/* Returns the size of a file in bytes (or -1). */
+long getFileSize( const std::string& fileName )
+{
+	std::ifstream file(fileName.c_str(), std::ios::binary | std::ios::ate);
+
+	if (file.is_open() == false)
+		return -1;
+
+	return (long)file.tellg();
+}
+
+
+/* Exports the solver into the given folder and prints the size of its code. */
+returnValue exportSolver(	const OCP& ocp, const std::string& folder, int condensing, int qpSolver,
+							int blocked, int codeSizeBudget, bool report, int profiling = NO )
+{
+	OCPexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
+	mpc.set( DISCRETIZATION_TYPE, MULTIPLE_SHOOTING );
+	mpc.set( INTEGRATOR_TYPE, INT_RK4 );
+	mpc.set( NUM_INTEGRATOR_STEPS, 10 * (int)ocp.getN() );
+
+	mpc.set( SPARSE_QP_SOLUTION, condensing );
+	mpc.set( QP_SOLVER, qpSolver );
+	mpc.set( CG_USE_BLOCKED_LINEAR_ALGEBRA, blocked );
+	mpc.set( CG_CODE_SIZE_BUDGET, codeSizeBudget );
+	mpc.set( CG_USE_PROFILING, profiling );
+
+	mpc.set( GENERATE_TEST_FILE, NO );
+	mpc.set( GENERATE_MAKE_FILE, NO );
+
+	double tic = acadoGetTime();
+
+	returnValue status = mpc.exportCode( folder );
+	if (status != SUCCESSFUL_RETURN)
+		return status;
+
+	printf("%s: export %.2f s, acado_solver.c %ld bytes, acado_integrator.c %ld bytes\n",
+			folder.c_str(), acadoGetTime() - tic,
+			getFileSize(folder + "/acado_solver.c"), getFileSize(folder + "/acado_integrator.c"));
+
+	if (report == true)
+		mpc.printCodeSizes();
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+int main( )
+{
+	const unsigned nMasses = 15;
+
+	const double m = 0.1;   // mass of each element
+	const double k = 10.0;  // stiffness of the springs
+	const double d = 0.05;  // damping of the springs
+
+	DifferentialState p("", nMasses, 1);  // positions, relative to the rest positions
+	DifferentialState v("", nMasses, 1);  // velocities
+	Control F("", 4, 1);                  // forces acting on masses 4, 8, 12 and 15
+
+	//
+	// The first mass is attached to a wall, the springs are stiffening
+	//
+	DifferentialEquation f;
+
+	for (unsigned i = 0; i < nMasses; ++i)
+		f << dot( p(i) ) == v(i);
+
+	for (unsigned i = 0; i < nMasses; ++i)
+	{
+		Expression left = i == 0 ? p(i) : p(i) - p(i - 1);
+		Expression dLeft = i == 0 ? v(i) : v(i) - v(i - 1);
+
+		Expression force = -k * (left + left * left * left) - d * dLeft;
+
+		if (i < nMasses - 1)
+			force = force + k * ((p(i + 1) - p(i)) + (p(i + 1) - p(i)) * (p(i + 1) - p(i)) * (p(i + 1) - p(i)))
+					+ d * (v(i + 1) - v(i));
+
+		if ((i + 1) % 4 == 0)
+			force = force + F((i + 1) / 4 - 1);
+		if (i == nMasses - 1)
+			force = force + F(3);
+
+		f << dot( v(i) ) == force / m;
+	}
+
+	Function h, hN;
+	h << p << v << F;
+	hN << p << v;
+
+	//
+	// Short horizon, condensed QP
+	//
+	OCP ocp(0.0, 2.0, 10);
+
+	ocp.subjectTo( f );
+
+	ocp.minimizeLSQ(eye<double>( h.getDim() ), h);
+	ocp.minimizeLSQEndTerm(eye<double>( hN.getDim() ), hN);
+
+	ocp.subjectTo( -1.0 <= F <= 1.0 );
+
+	if (exportSolver(ocp, "chain_mass_benchmark_export", CONDENSING, QP_QPOASES, YES, 0, false, YES) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	if (exportSolver(ocp, "chain_mass_benchmark_loops_export", CONDENSING, QP_QPOASES, NO, 0, false) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	//
+	// Long horizon, fully condensed QP
+	//
+	OCP ocpLong(0.0, 10.0, 50);
+
+	ocpLong.subjectTo( f );
+
+	ocpLong.minimizeLSQ(eye<double>( h.getDim() ), h);
+	ocpLong.minimizeLSQEndTerm(eye<double>( hN.getDim() ), hN);
+
+	ocpLong.subjectTo( -1.0 <= F <= 1.0 );
+
+	if (exportSolver(ocpLong, "chain_mass_long_export", FULL_CONDENSING, QP_QPOASES, NO, 0, true) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	if (exportSolver(ocpLong, "chain_mass_long_budget_export", FULL_CONDENSING, QP_QPOASES, NO, 200000, true) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	//
+	// Long horizon, block condensed QP with automatically selected block size
+	//
+	if (exportSolver(ocpLong, "chain_mass_long_block_export", BLOCK_CONDENSING_N2, QP_QPDUNES, NO, 0, false) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	return EXIT_SUCCESS;
+}
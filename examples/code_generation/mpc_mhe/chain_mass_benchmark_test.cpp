@@ -0,0 +1,115 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/*
+ * Timing of the chain of masses NMPC exported by chain_mass_benchmark.cpp:
+ * the chain starts from a displaced position and is brought back to rest.
+ * Reports the average times of the preparation and the feedback steps, and
+ * the statistics of their phases collected by the profiling hooks.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+
+#define NX          ACADO_NX	/* number of differential states */
+#define NUM_STEPS   100			/* number of real-time iterations */
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+int main()
+{
+	unsigned i, iter;
+	int status;
+	timer t;
+	real_t prepSum = 0.0, fdbSum = 0.0;
+
+	memset(&acadoWorkspace, 0, sizeof( acadoWorkspace ));
+	memset(&acadoVariables, 0, sizeof( acadoVariables ));
+
+	initializeSolver();
+#if ACADO_PROFILING
+	resetProfile();
+#endif
+
+	// Displaced chain at rest
+	for (i = 0; i < NX / 2; ++i)
+		acadoVariables.x0[ i ] = 0.05 * (i + 1);
+
+	for (iter = 0; iter < NUM_STEPS; ++iter)
+	{
+		tic( &t );
+		preparationStep();
+		prepSum += toc( &t );
+
+		tic( &t );
+		status = feedbackStep( );
+		fdbSum += toc( &t );
+
+		if ( status )
+		{
+			cout << "Iteration:" << iter << ", QP problem! QP status: " << status << endl;
+
+			return EXIT_FAILURE;
+		}
+
+		for (i = 0; i < NX; ++i)
+			acadoVariables.x0[ i ] = acadoVariables.x[NX + i];
+
+		shiftStates(2, 0, 0);
+		shiftControls( 0 );
+	}
+
+	cout << "KKT value after " << NUM_STEPS << " iterations: " << scientific << getKKT() << endl;
+	cout << "Average preparation time: " << scientific << prepSum / NUM_STEPS * 1e6 << " microseconds" << endl;
+	cout << "Average feedback time:    " << scientific << fdbSum / NUM_STEPS * 1e6 << " microseconds" << endl;
+
+	// The chain has to be at rest by now
+	if ( !(getKKT() < 1e-6) )
+		return EXIT_FAILURE;
+
+#if ACADO_PROFILING
+	ACADOprofileStatistics stats;
+
+	printProfile();
+
+	// Every RTI step has to be profiled, and the integration once per shooting interval
+	getProfileStatistics(ACADO_PROFILE_FEEDBACK, &stats);
+	if (stats.count != NUM_STEPS || !(stats.min <= stats.p99 && stats.p99 <= stats.max))
+		return EXIT_FAILURE;
+	getProfileStatistics(ACADO_PROFILE_INTEGRATION, &stats);
+	if (stats.count != NUM_STEPS * ACADO_N)
+		return EXIT_FAILURE;
+#endif
+
+    return EXIT_SUCCESS;
+}
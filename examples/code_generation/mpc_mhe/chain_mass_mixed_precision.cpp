@@ -0,0 +1,115 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file   examples/code_generation/chain_mass_mixed_precision.cpp
+ *    \author Milan Vukov
+ *    \date   2014
+ *
+ *    NMPC of the chain of masses of chain_mass_benchmark.cpp, exported with
+ *    the mixed precision mode: the sensitivities are propagated by the RK4
+ *    integrator in single precision, while the nominal trajectory, the
+ *    condensing and the QP are computed in double precision. See
+ *    chain_mass_mixed_precision_test.cpp for the timings.
+ */
+
+#include <acado_code_generation.hpp>
+
+USING_NAMESPACE_ACADO
+
+
+int main( )
+{
+	const unsigned nMasses = 15;
+
+	const double m = 0.1;   // mass of each element
+	const double k = 10.0;  // stiffness of the springs
+	const double d = 0.05;  // damping of the springs
+
+	DifferentialState p("", nMasses, 1);  // positions, relative to the rest positions
+	DifferentialState v("", nMasses, 1);  // velocities
+	Control F("", 4, 1);                  // forces acting on masses 4, 8, 12 and 15
+
+	//
+	// The first mass is attached to a wall, the springs are stiffening
+	//
+	DifferentialEquation f;
+
+	for (unsigned i = 0; i < nMasses; ++i)
+		f << dot( p(i) ) == v(i);
+
+	for (unsigned i = 0; i < nMasses; ++i)
+	{
+		Expression left = i == 0 ? p(i) : p(i) - p(i - 1);
+		Expression dLeft = i == 0 ? v(i) : v(i) - v(i - 1);
+
+		Expression force = -k * (left + left * left * left) - d * dLeft;
+
+		if (i < nMasses - 1)
+			force = force + k * ((p(i + 1) - p(i)) + (p(i + 1) - p(i)) * (p(i + 1) - p(i)) * (p(i + 1) - p(i)))
+					+ d * (v(i + 1) - v(i));
+
+		if ((i + 1) % 4 == 0)
+			force = force + F((i + 1) / 4 - 1);
+		if (i == nMasses - 1)
+			force = force + F(3);
+
+		f << dot( v(i) ) == force / m;
+	}
+
+	Function h, hN;
+	h << p << v << F;
+	hN << p << v;
+
+	OCP ocp(0.0, 2.0, 10);
+
+	ocp.subjectTo( f );
+
+	ocp.minimizeLSQ(eye<double>( h.getDim() ), h);
+	ocp.minimizeLSQEndTerm(eye<double>( hN.getDim() ), hN);
+
+	ocp.subjectTo( -1.0 <= F <= 1.0 );
+
+	OCPexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
+	mpc.set( DISCRETIZATION_TYPE, MULTIPLE_SHOOTING );
+	mpc.set( INTEGRATOR_TYPE, INT_RK4 );
+	mpc.set( NUM_INTEGRATOR_STEPS, 10 * (int)ocp.getN() );
+
+	mpc.set( SPARSE_QP_SOLUTION, CONDENSING );
+	mpc.set( QP_SOLVER, QP_QPOASES );
+	mpc.set( CG_USE_MIXED_PRECISION, YES );
+
+	mpc.set( GENERATE_TEST_FILE, NO );
+	mpc.set( GENERATE_MAKE_FILE, NO );
+
+	if (mpc.exportCode( "chain_mass_mixed_precision_export" ) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	mpc.printDimensionsQP( );
+
+	return EXIT_SUCCESS;
+}
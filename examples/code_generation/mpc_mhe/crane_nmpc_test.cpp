@@ -0,0 +1,125 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/*
+ * Closed-loop benchmark of the crane NMPC exported by crane_nmpc.cpp: the
+ * trolley is moved back and forth between two positions, so that the
+ * bounds on the acceleration and the velocity become active and inactive
+ * again. Reports the number of QP iterations per real-time iteration.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+
+#define NX          ACADO_NX	/* number of differential states */
+#define NU          ACADO_NU	/* number of control inputs */
+#define N          	ACADO_N		/* number of control intervals */
+#define NY			ACADO_NY	/* number of references, nodes 0..N - 1 */
+#define NYN			ACADO_NYN
+#define NUM_STEPS   200			/* number of simulation steps */
+#define VERBOSE     1			/* show iterations: 1, silent: 0 */
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+int main()
+{
+	unsigned i, iter;
+	int status, nWSR;
+	int nWSRSum = 0, nWSRMax = 0;
+	timer t;
+	real_t fdbSum = 0.0;
+
+	memset(&acadoWorkspace, 0, sizeof( acadoWorkspace ));
+	memset(&acadoVariables, 0, sizeof( acadoVariables ));
+
+	initializeSolver();
+
+	// Unit weights
+	for (i = 0; i < NY; ++i)
+		acadoVariables.W[i * NY + i] = 1.0;
+	for (i = 0; i < NYN; ++i)
+		acadoVariables.WN[i * NYN + i] = 1.0;
+
+	preparationStep();
+
+	for (iter = 0; iter < NUM_STEPS; ++iter)
+	{
+		//
+		// Reference: switch the trolley position every 50 steps
+		//
+		for (i = 0; i < N; ++i)
+			acadoVariables.y[i * NY + 0] = (iter / 50) % 2 == 0 ? 3.0 : -1.0;
+		acadoVariables.yN[ 0 ] = acadoVariables.y[ 0 ];
+
+		tic( &t );
+		status = feedbackStep( );
+		fdbSum += toc( &t );
+
+		if ( status )
+		{
+			cout << "Iteration:" << iter << ", QP problem! QP status: " << status << endl;
+
+			return EXIT_FAILURE;
+		}
+
+		nWSR = getNWSR();
+		nWSRSum += nWSR;
+		if (nWSR > nWSRMax)
+			nWSRMax = nWSR;
+
+#if VERBOSE
+		if (iter % 10 == 0)
+			cout	<< "Iteration #" << setw( 4 ) << iter
+					<< ", QP iterations: " << setw( 3 ) << nWSR
+					<< ", KKT value: " << scientific << getKKT()
+					<< endl;
+#endif // VERBOSE
+
+		//
+		// The plant follows the prediction
+		//
+		for (i = 0; i < NX; ++i)
+			acadoVariables.x0[ i ] = acadoVariables.x[NX + i];
+
+		shiftStates(2, 0, 0);
+		shiftControls( 0 );
+
+		preparationStep();
+	}
+
+	cout << "QP iterations per step:   " << fixed << setprecision( 2 ) << (double)nWSRSum / NUM_STEPS
+		 << " on average, " << nWSRMax << " at most" << endl;
+	cout << "Average feedback time:    " << scientific << fdbSum / NUM_STEPS * 1e6 << " microseconds" << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file   examples/code_generation/getting_started_reentrant.cpp
+ *    \author Milan Vukov
+ *    \date   2014
+ *
+ *    Exports the getting started MPC problem as reentrant code: all data
+ *    of the solver is kept in a context, so that several instances of the
+ *    solver can run concurrently, see getting_started_reentrant_test.cpp.
+ */
+
+#include <acado_code_generation.hpp>
+
+int main( )
+{
+	USING_NAMESPACE_ACADO
+
+	// Variables:
+	DifferentialState   p    ;  // the trolley position
+	DifferentialState   v    ;  // the trolley velocity 
+	DifferentialState   phi  ;  // the excitation angle
+	DifferentialState   omega;  // the angular velocity
+	Control             a    ;  // the acc. of the trolley
+
+	const double     g = 9.81;  // the gravitational constant 
+	const double     b = 0.20;  // the friction coefficient
+
+	// Model equations:
+	DifferentialEquation f; 
+
+	f << dot( p ) == v;
+	f << dot( v ) == a;
+	f << dot( phi ) == omega;
+	f << dot( omega ) == -g * sin(phi) - a * cos(phi) - b * omega;
+
+	// Reference functions and weighting matrices:
+	Function h, hN;
+	h << p << v << phi << omega << a;
+	hN << p << v << phi << omega;
+
+	DMatrix W = eye<double>( h.getDim() );
+	DMatrix WN = eye<double>( hN.getDim() );
+	WN *= 5;
+
+	//
+	// Optimal Control Problem
+	//
+	OCP ocp(0.0, 3.0, 10);
+
+	ocp.subjectTo( f );
+
+	ocp.minimizeLSQ(W, h);
+	ocp.minimizeLSQEndTerm(WN, hN);
+
+	ocp.subjectTo( -1.0 <= a <= 1.0 );
+	ocp.subjectTo( -0.5 <= v <= 1.5 );
+
+	// Export the code:
+	OCPexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION,       GAUSS_NEWTON    );
+	mpc.set( DISCRETIZATION_TYPE,         MULTIPLE_SHOOTING );
+	mpc.set( SPARSE_QP_SOLUTION,          FULL_CONDENSING );
+	mpc.set( INTEGRATOR_TYPE,             INT_RK4         );
+	mpc.set( NUM_INTEGRATOR_STEPS,        30              );
+
+	mpc.set( QP_SOLVER,                   QP_QPOASES      );
+	mpc.set( CG_USE_REENTRANT_CODE,       YES             );
+	mpc.set( GENERATE_TEST_FILE,          YES             );
+	mpc.set( GENERATE_MAKE_FILE,          YES             );
+
+	if (mpc.exportCode( "getting_started_reentrant_export" ) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	mpc.printDimensionsQP( );
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/*
+ * Runs several instances of the reentrant solver exported by
+ * getting_started_reentrant.cpp concurrently, one context per thread,
+ * and checks that each of them gives the same closed-loop trajectory
+ * as a single instance run alone.
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+
+#define NX          ACADO_NX	/* number of differential states */
+#define NU          ACADO_NU	/* number of control inputs */
+#define N          	ACADO_N		/* number of control intervals */
+#define NY			ACADO_NY	/* number of references, nodes 0..N - 1 */
+#define NYN			ACADO_NYN
+#define NUM_STEPS   50			/* number of closed-loop steps */
+#define NUM_INSTANCES	8		/* number of concurrent solver instances */
+
+/* Closed-loop simulation with one solver instance; the controls applied
+ * to the plant are logged in uLog, the return value is the number of
+ * failed QPs. */
+static int runClosedLoop(ACADOcontext* acadoContext, real_t* uLog)
+{
+	int i, iter, status, nFailed = 0;
+
+	memset(acadoContext, 0, sizeof( ACADOcontext ));
+
+	initializeSolver( acadoContext );
+
+	/* Start away from the reference, which is the origin. */
+	for (i = 0; i < N + 1; ++i)
+	{
+		acadoVariables.x[i * NX + 0] = 0.5;
+		acadoVariables.x[i * NX + 2] = 0.1;
+	}
+	for (i = 0; i < NX; ++i)
+		acadoVariables.x0[ i ] = acadoVariables.x[ i ];
+
+	for (iter = 0; iter < NUM_STEPS; ++iter)
+	{
+		preparationStep( acadoContext );
+		status = feedbackStep( acadoContext );
+		if (status != 0)
+			++nFailed;
+
+		for (i = 0; i < NU; ++i)
+			uLog[iter * NU + i] = acadoVariables.u[ i ];
+
+		/* Use the predicted state as the next measurement. */
+		for (i = 0; i < NX; ++i)
+			acadoVariables.x0[ i ] = acadoVariables.x[NX + i];
+	}
+
+	return nFailed;
+}
+
+int main()
+{
+	unsigned i, j;
+	timer t;
+	real_t tSequential, tConcurrent;
+
+	vector< ACADOcontext > contexts( NUM_INSTANCES );
+	vector< vector< real_t > > uLogs(NUM_INSTANCES, vector< real_t >(NUM_STEPS * NU));
+	vector< int > nFailed( NUM_INSTANCES );
+	vector< real_t > uReference(NUM_STEPS * NU);
+
+	//
+	// Reference trajectory, and the time for all instances one after another
+	//
+	if (runClosedLoop(&contexts[ 0 ], &uReference[ 0 ]) != 0)
+	{
+		cout << "The reference run failed." << endl;
+		return EXIT_FAILURE;
+	}
+
+	tic( &t );
+	for (i = 0; i < NUM_INSTANCES; ++i)
+		runClosedLoop(&contexts[ i ], &uLogs[ i ][ 0 ]);
+	tSequential = toc( &t );
+
+	//
+	// All instances concurrently, one thread each
+	//
+	for (i = 0; i < NUM_INSTANCES; ++i)
+		fill(uLogs[ i ].begin(), uLogs[ i ].end(), 0.0);
+
+	tic( &t );
+	vector< thread > threads;
+	for (i = 0; i < NUM_INSTANCES; ++i)
+		threads.push_back(thread([&, i]()
+		{
+			nFailed[ i ] = runClosedLoop(&contexts[ i ], &uLogs[ i ][ 0 ]);
+		}));
+	for (i = 0; i < NUM_INSTANCES; ++i)
+		threads[ i ].join();
+	tConcurrent = toc( &t );
+
+	//
+	// The instances must not interfere
+	//
+	for (i = 0; i < NUM_INSTANCES; ++i)
+	{
+		if (nFailed[ i ] != 0)
+		{
+			cout << "Instance " << i << ": " << nFailed[ i ] << " QPs failed." << endl;
+			return EXIT_FAILURE;
+		}
+		for (j = 0; j < NUM_STEPS * NU; ++j)
+			if (fabs(uLogs[ i ][ j ] - uReference[ j ]) > 1.0e-12)
+			{
+				cout << "Instance " << i << " deviates from the reference at step "
+					 << j / NU << ": " << uLogs[ i ][ j ] << " vs. " << uReference[ j ] << endl;
+				return EXIT_FAILURE;
+			}
+	}
+
+	cout << "First controls: ";
+	for (j = 0; j < 5; ++j)
+		cout << uReference[ j * NU ] << " ";
+	cout << endl;
+
+	cout << NUM_INSTANCES << " instances x " << NUM_STEPS << " RTIs, "
+		 << thread::hardware_concurrency() << " hardware threads" << endl;
+	cout << "  sequential: " << NUM_INSTANCES * NUM_STEPS / tSequential << " RTIs/s" << endl;
+	cout << "  concurrent: " << NUM_INSTANCES * NUM_STEPS / tConcurrent << " RTIs/s" << endl;
+
+	return EXIT_SUCCESS;
+}
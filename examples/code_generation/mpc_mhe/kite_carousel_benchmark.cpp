@@ -0,0 +1,188 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file   examples/code_generation/kite_carousel_benchmark.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ *    \date   2014
+ *
+ *    Measures the time and the peak memory that are needed to build the
+ *    symbolic model of kite_carousel.cpp for a chain of 50 coupled
+ *    carousels (200 states) and to copy it, as well as the time needed
+ *    to export the code of the original MPC problem.
+ */
+
+#include <acado_code_generation.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+USING_NAMESPACE_ACADO
+
+
+/* Returns the peak resident memory of the process in MB (or -1). */
+double getPeakMemory( )
+{
+#if defined(__unix__) || defined(__APPLE__)
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+	return (double)usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+	return (double)usage.ru_maxrss / 1024.0;
+#endif
+#else
+	return -1.0;
+#endif
+}
+
+
+/* Builds the right-hand side of a chain of carousels; each kite feels */
+/* the roll angles of all previous ones, which yields a long chain of   */
+/* intermediate states. x holds (phi, theta, dphi, dtheta) of each kite */
+/* and u holds (u1, u2) of each kite.                                    */
+void buildKiteModel( const DifferentialState& x, const Control& u, DifferentialEquation& f )
+{
+	const double R = 1.00;// radius of the carousel arm
+	const double Omega = 1.00;// constant rotational velocity of the carousel arm
+	const double m = 0.80;// the mass of the plane
+	const double r = 1.00;// length of the cable between arm and plane
+	const double A = 0.15;// wing area of the plane
+
+	const double rho = 1.20;// density of the air
+	const double CL = 1.00;// nominal lift coefficient
+	const double CD = 0.15;// nominal drag coefficient
+	const double b = 15.00;// roll stabilization coefficient
+	const double g = 9.81;// gravitational constant
+
+	const unsigned nKites = x.getDim() / 4;
+
+	Expression rhs;
+	IntermediateState coupling = 0.0;
+
+	for (unsigned i = 0; i < nKites; ++i)
+	{
+		Expression phi = x(4 * i), theta = x(4 * i + 1), dphi = x(4 * i + 2), dtheta = x(4 * i + 3);
+		Expression u1 = u(2 * i), u2 = u(2 * i + 1);
+
+		IntermediateState c;// c := rho * |we|^2 / (2*m)
+
+		c = ( (R*R*Omega*Omega)
+				+ (r*r)*( (Omega+dphi)*(Omega+dphi) + dtheta*dtheta )
+				+ (2.0*r*R*Omega)*( (Omega+dphi)*sin(theta)*cos(phi)
+						+ dtheta*cos(theta)*sin(phi) ) ) * ( A*rho/( 2.0*m ) );
+
+		if (nKites > 1)
+			coupling = 0.5*coupling + 0.01*sin(phi);
+
+		rhs << dphi;
+		rhs << dtheta;
+
+		rhs << ( 2.0*r*(Omega+dphi)*dtheta*cos(theta)
+				+ (R*Omega*Omega)*sin(phi)
+				+ c*(CD*(1.0+u2)+CL*(1.0+0.5*u2)*phi) + coupling ) / (-r*sin(theta));
+
+		rhs << ( (R*Omega*Omega)*cos(theta)*cos(phi)
+				+ r*(Omega+dphi)*sin(theta)*cos(theta)
+				+ g*sin(theta) - c*( CL*u1 + b*dtheta ) ) / r;
+	}
+
+	f << dot(x) == rhs;
+}
+
+
+int main()
+{
+	//
+	// Symbolic construction of a chain of 50 carousels (200 states):
+	//
+	double tic = acadoGetTime();
+
+	DifferentialState xChain("", 200, 1);
+	Control uChain("", 100, 1);
+	DifferentialEquation fChain;
+
+	buildKiteModel(xChain, uChain, fChain);
+
+	double tConstruction = acadoGetTime() - tic;
+
+	tic = acadoGetTime();
+	for (unsigned run = 0; run < 20; ++run)
+	{
+		DifferentialEquation fCopy( fChain );
+		Expression rhsCopy;
+		fCopy.getExpression( rhsCopy );
+	}
+	double tCopies = acadoGetTime() - tic;
+
+	printf("50 carousels: %d states, %d intermediate states\n", fChain.getNX(), fChain.getN());
+	printf("  construction: %.3e s, 20 copies: %.3e s, peak memory: %.1f MB\n",
+			tConstruction, tCopies, getPeakMemory());
+	printf("  operator store: %d nodes, %d reused\n",
+			OperatorStore::getNumberOfNodes(), OperatorStore::getNumberOfHits());
+
+	//
+	// Code export of the original kite carousel MPC problem:
+	//
+	clearAllStaticCounters( );
+
+	tic = acadoGetTime();
+
+	DifferentialState x("", 4, 1);
+	Control u("", 2, 1);
+	DifferentialEquation f;
+
+	buildKiteModel(x, u, f);
+
+	Function h, hN;
+	h << x << u;
+	hN << x;
+
+	OCP ocp( 0.0, 2.0 * M_PI, 10 );
+
+	ocp.subjectTo( f );
+
+	ocp.minimizeLSQ(eye<double>( h.getDim() ), h);
+	ocp.minimizeLSQEndTerm(eye<double>( hN.getDim() ), hN);
+
+	OCPexport mpc(ocp);
+
+	mpc.set( INTEGRATOR_TYPE , INT_RK4 );
+	mpc.set( NUM_INTEGRATOR_STEPS , 30 );
+	mpc.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
+	mpc.set( HOTSTART_QP, YES );
+	mpc.set( GENERATE_TEST_FILE, NO );
+	mpc.set( GENERATE_MAKE_FILE, NO );
+
+	if (mpc.exportCode("kite_carousel_benchmark_export") != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	double tExport = acadoGetTime() - tic;
+
+	printf("kite carousel export: %.3e s, peak memory (total): %.1f MB\n", tExport, getPeakMemory());
+
+	return EXIT_SUCCESS;
+}
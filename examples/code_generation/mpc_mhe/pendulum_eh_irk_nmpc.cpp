@@ -0,0 +1,90 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+ /**
+ *    \file   examples/code_generation/pendulum_eh_irk_nmpc.cpp
+ *    \author Rien Quirynen
+ *    \date   2014
+ *
+ *    NMPC of an inverted pendulum on a cart with the exact Hessian RTI
+ *    scheme and a Gauss-Legendre integrator. The forward sweep of the
+ *    integrator stores the factorized Newton matrix of every step, the
+ *    backward sweep reuses it for the adjoint and second order sensitivities.
+ *
+ *    The OCP is the one of pendulum_eh_nmpc.cpp, see
+ *    pendulum_eh_irk_nmpc_test.cpp for the closed-loop test.
+ */
+
+#include <acado_code_generation.hpp>
+
+USING_NAMESPACE_ACADO
+
+int main( )
+{
+	DifferentialState	p, theta, v, omega;  // cart position, angle from the upright position, velocities
+	Control				F;                   // force acting on the cart
+
+	const double		M = 1.0;   // mass of the cart
+	const double		m = 0.1;   // mass of the pendulum
+	const double		l = 0.5;   // length of the pendulum
+	const double		g = 9.81;
+
+	DifferentialEquation f;
+
+	f << dot( p ) == v;
+	f << dot( theta ) == omega;
+	f << dot( v ) == (F + m * l * sin( theta ) * omega * omega - m * g * cos( theta ) * sin( theta ))
+			/ (M + m - m * cos( theta ) * cos( theta ));
+	f << dot( omega ) == (F * cos( theta ) - (M + m) * g * sin( theta ) + m * l * cos( theta ) * sin( theta ) * omega * omega)
+			/ (l * (m * cos( theta ) * cos( theta ) - (M + m)));
+
+	OCP ocp(0.0, 2.0, 20);
+
+	ocp.subjectTo( f );
+
+	ocp.minimizeLagrangeTerm( 10 * p * p + 10 * theta * theta + v * v + omega * omega + 0.01 * F * F );
+	ocp.minimizeMayerTerm( 10 * (p * p + theta * theta + v * v + omega * omega) );
+
+	ocp.subjectTo( -20.0 <= F <= 20.0 );
+
+	OCPexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION, EXACT_HESSIAN );
+	mpc.set( DISCRETIZATION_TYPE, MULTIPLE_SHOOTING );
+	mpc.set( DYNAMIC_SENSITIVITY, THREE_SWEEPS );
+	mpc.set( INTEGRATOR_TYPE, INT_IRK_GL4 );
+	mpc.set( NUM_INTEGRATOR_STEPS, 10 );
+
+	mpc.set( SPARSE_QP_SOLUTION, FULL_CONDENSING_N2 );
+	mpc.set( QP_SOLVER, QP_QPOASES );
+	mpc.set( CG_HESSIAN_REGULARIZATION, REGULARIZE_MODIFIED_CHOLESKY );
+
+	mpc.set( GENERATE_TEST_FILE, NO );
+	mpc.set( GENERATE_MAKE_FILE, NO );
+
+	if (mpc.exportCode( "pendulum_eh_irk_nmpc_export" ) != SUCCESSFUL_RETURN)
+		exit( EXIT_FAILURE );
+
+	return EXIT_SUCCESS;
+}
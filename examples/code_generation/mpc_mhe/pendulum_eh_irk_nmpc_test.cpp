@@ -0,0 +1,107 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/*
+ * Closed-loop test of the cart-pendulum NMPC with exact Hessian and a Gauss-
+ * Legendre integrator exported by pendulum_eh_irk_nmpc.cpp: the pendulum
+ * starts from a large deflection and is stabilized in the upright position.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+
+#define NX          ACADO_NX	/* number of differential states */
+#define NUM_STEPS   100			/* number of real-time iterations */
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+int main()
+{
+	unsigned i, iter;
+	int status;
+	timer t;
+	real_t prepSum = 0.0, fdbSum = 0.0;
+
+	memset(&acadoWorkspace, 0, sizeof( acadoWorkspace ));
+	memset(&acadoVariables, 0, sizeof( acadoVariables ));
+
+	initializeSolver();
+
+	acadoVariables.x0[ 0 ] = 0.5;
+	acadoVariables.x0[ 1 ] = 1.0;
+
+	for (i = 0; i < ACADO_N + 1; ++i)
+	{
+		acadoVariables.x[i * NX + 0] = 0.5;
+		acadoVariables.x[i * NX + 1] = 1.0;
+	}
+
+	for (iter = 0; iter < NUM_STEPS; ++iter)
+	{
+		tic( &t );
+		preparationStep();
+		prepSum += toc( &t );
+
+		tic( &t );
+		status = feedbackStep( );
+		fdbSum += toc( &t );
+
+		if ( status )
+		{
+			cout << "Iteration:" << iter << ", QP problem! QP status: " << status << endl;
+
+			return EXIT_FAILURE;
+		}
+
+		for (i = 0; i < NX; ++i)
+			acadoVariables.x0[ i ] = acadoVariables.x[NX + i];
+
+		shiftStates(2, 0, 0);
+		shiftControls( 0 );
+	}
+
+	cout << "KKT value after " << NUM_STEPS << " iterations: " << scientific << getKKT() << endl;
+	cout << "Final state: " << fixed << setprecision( 4 );
+	for (i = 0; i < NX; ++i)
+		cout << acadoVariables.x0[ i ] << " ";
+	cout << endl;
+	cout << "Average preparation time: " << scientific << prepSum / NUM_STEPS * 1e6 << " microseconds" << endl;
+	cout << "Average feedback time:    " << scientific << fdbSum / NUM_STEPS * 1e6 << " microseconds" << endl;
+
+	// The pendulum has to be upright by now
+	if ( !(getKKT() < 1e-6) || fabs( acadoVariables.x0[ 1 ] ) > 1e-3 )
+		return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
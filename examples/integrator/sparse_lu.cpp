@@ -0,0 +1,129 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/sparse_lu.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ *    \date 2014
+ *
+ *    Integrates a method-of-lines discretization of a reaction-diffusion
+ *    DAE with the BDF integrator, once with dense QR decompositions of the
+ *    Newton matrices (HOUSEHOLDER_METHOD) and once with sparse LU
+ *    decompositions (SPARSE_LU), and compares run times and results of the
+ *    integration and of the backward sensitivities.
+ */
+
+
+#include <acado_integrators.hpp>
+
+USING_NAMESPACE_ACADO
+
+
+const int N = 60;    // number of grid points
+
+
+/* Integrates f with the given linear algebra solver and returns the run time. */
+double integrate( DifferentialEquation &f, int las, double *x0, double *xa0,
+                  DVector &xEnd, DVector &Dx ){
+
+    IntegratorBDF integrator( f );
+
+    integrator.set( INTEGRATOR_TOLERANCE , 1e-8 );
+    integrator.set( ABSOLUTE_TOLERANCE   , 1e-8 );
+    integrator.set( LINEAR_ALGEBRA_SOLVER, las  );
+
+    double tic = acadoGetTime();
+
+    integrator.freezeAll();
+    integrator.integrate( 0.0, 1.0, x0, xa0 );
+
+    DVector seed( N );
+    seed.setZero();
+    seed( N/2 ) = 1.0;
+
+    integrator.setBackwardSeed( 1, seed );
+    integrator.integrateSensitivities();
+
+    double time = acadoGetTime() - tic;
+
+    Dx.init( N );
+    integrator.getX( xEnd );
+    integrator.getBackwardSensitivities( Dx, emptyVector, emptyVector, emptyVector, 1 );
+
+    return time;
+}
+
+
+int main( ){
+
+    int run1;
+
+    // Define a reaction-diffusion DAE:
+    // --------------------------------
+    DifferentialState u( "", N, 1 );
+    AlgebraicState    r( "", N, 1 );
+
+    const double alpha = 0.1*(N+1)*(N+1);
+
+    DifferentialEquation f;
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        Expression left  = ( run1 > 0   ) ? Expression( u(run1-1) ) : Expression( 0.0 );
+        Expression right = ( run1 < N-1 ) ? Expression( u(run1+1) ) : Expression( 0.0 );
+
+        f << dot( u(run1) ) == alpha*( left - 2.0*u(run1) + right ) + r(run1);
+    }
+    for( run1 = 0; run1 < N; run1++ )
+        f << 0 == r(run1) - u(run1) + u(run1)*u(run1)*u(run1);
+
+
+    // Define the initial values:
+    // --------------------------
+    double x0 [N];
+    double xa0[N];
+
+    for( run1 = 0; run1 < N; run1++ ){
+        x0 [run1] = sin( M_PI*(run1+1)/(N+1) );
+        xa0[run1] = x0[run1] - x0[run1]*x0[run1]*x0[run1];
+    }
+
+
+    // Integrate with both linear algebra solvers:
+    // -------------------------------------------
+    DVector xDense, xSparse, DxDense, DxSparse;
+
+    double tDense  = integrate( f, HOUSEHOLDER_METHOD, x0, xa0, xDense , DxDense  );
+    double tSparse = integrate( f, SPARSE_LU         , x0, xa0, xSparse, DxSparse );
+
+    printf( "reaction-diffusion DAE: %d differential and %d algebraic states\n", N, N );
+    printf( "  dense QR: %.3e s, sparse LU: %.3e s, speed-up: %.2f\n", tDense, tSparse, tDense/tSparse );
+    printf( "  max. deviation: x %.3e, backward sensitivities %.3e\n",
+            DVector(xDense - xSparse).getNorm( VN_LINF ), DVector(DxDense - DxSparse).getNorm( VN_LINF ) );
+
+    return 0;
+}
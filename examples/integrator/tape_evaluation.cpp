@@ -0,0 +1,195 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/tape_evaluation.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
+ *    \date 2014
+ *
+ *    Compares the evaluation of the right-hand sides of the pendulum and the
+ *    CSTR example by walking the operator trees (FEM_TREE) and by
+ *    interpreting a compiled instruction tape (FEM_TAPE).
+ */
+
+
+#include <acado_integrators.hpp>
+
+USING_NAMESPACE_ACADO
+
+
+const int nRepetitions = 20000;
+
+
+/* Times evaluate, AD_forward and AD_backward and returns the total time. */
+double timeFunction( Function &f, double *x, double *seed, double *res, double *dres,
+                     double *bseed, double *adj ){
+
+    int run1, run2;
+    int nVar = f.getNumberOfVariables()+1;
+
+    double tic = acadoGetTime();
+
+    for( run1 = 0; run1 < nRepetitions; run1++ ){
+
+        f.evaluate( 0, x, res );
+        f.AD_forward( 0, seed, dres );
+
+        for( run2 = 0; run2 < nVar; run2++ )
+            adj[run2] = 0.0;
+        f.AD_backward( 0, bseed, adj );
+    }
+
+    return acadoGetTime() - tic;
+}
+
+
+/* Runs both evaluation modes on f and prints timings and deviations. */
+void compareModes( const char *name, DifferentialEquation &f ){
+
+    int run1;
+
+    DifferentialEquation fTree = f;
+    DifferentialEquation fTape = f;
+    fTape.setEvaluationMode( FEM_TAPE );
+
+    int nVar = f.getNumberOfVariables()+1;
+    int dim  = f.getDim();
+
+    DVector x1(nVar), x2(nVar), s1(nVar), s2(nVar), a1(nVar), a2(nVar);
+    DVector r1(dim), r2(dim), d1(dim), d2(dim), bseed(dim);
+
+    for( run1 = 0; run1 < nVar; run1++ ){
+        x1(run1) = x2(run1) = 0.5 + 0.1*run1/nVar;
+        s1(run1) = s2(run1) = 1.0 - 0.2*run1/nVar;
+    }
+    for( run1 = 0; run1 < dim; run1++ )
+        bseed(run1) = 1.0 + run1;
+
+    double tTree = timeFunction( fTree, x1.data(), s1.data(), r1.data(), d1.data(), bseed.data(), a1.data() );
+    double tTape = timeFunction( fTape, x2.data(), s2.data(), r2.data(), d2.data(), bseed.data(), a2.data() );
+
+    printf( "%s: %d outputs, %d intermediate states\n", name, dim, f.getN() );
+    printf( "  tree walker: %.3e s, tape: %.3e s, speed-up: %.2f\n", tTree, tTape, tTree/tTape );
+    printf( "  max. deviation: f %.3e, forward %.3e, backward %.3e\n",
+            DVector(r1 - r2).getNorm( VN_LINF ), DVector(d1 - d2).getNorm( VN_LINF ), DVector(a1 - a2).getNorm( VN_LINF ) );
+}
+
+
+int main( ){
+
+    // The pendulum from pendulum.cpp:
+    // -------------------------------
+    DifferentialState      phi, dphi;
+    Control                F;
+    Parameter              l;
+
+    const double m     = 1.0  ;
+    const double g     = 9.81 ;
+    const double alpha = 2.0  ;
+
+    IntermediateState    z;
+    DifferentialEquation f1;
+
+    z = sin(phi);
+
+    f1 << dot(phi ) == dphi;
+    f1 << dot(dphi) == -(m*g/l)*z - alpha*dphi + F/(m*l);
+
+    compareModes( "pendulum", f1 );
+
+
+    // The CSTR from cstr.cpp (without the Riccati part):
+    // --------------------------------------------------
+    DifferentialState cA, cB, theta, thetaK;
+    Control           u1, u2;
+
+    const double k10 =  1.287e12;
+    const double k20 =  1.287e12;
+    const double k30 =  9.043e09;
+    const double E1  =  -9758.3;
+    const double E2  =  -9758.3;
+    const double E3  =  -8560.0;
+    const double H1  =      4.2;
+    const double H2  =    -11.0;
+    const double H3  =    -41.85;
+    const double rho =      0.9342;
+    const double Cp  =      3.01;
+    const double kw  =   4032.0;
+    const double AR  =      0.215;
+    const double VR  =     10.0;
+    const double mK  =      5.0;
+    const double CPK =      2.0;
+    const double cA0    =    5.1;
+    const double theta0 =  104.9;
+    const double tu     = 3600.0;
+
+    IntermediateState k1, k2, k3;
+
+    k1 = k10*exp(E1/(273.15 +theta));
+    k2 = k20*exp(E2/(273.15 +theta));
+    k3 = k30*exp(E3/(273.15 +theta));
+
+    DifferentialEquation f2;
+
+    f2 << dot(cA)     == (1/tu)*(u1*(cA0-cA) - k1*cA - k3*cA*cA);
+    f2 << dot(cB)     == (1/tu)*(- u1*cB + k1*cA - k2*cB);
+    f2 << dot(theta)  == (1/tu)*(u1*(theta0-theta) - (1/(rho*Cp)) *(k1*cA*H1 + k2*cB*H2 + k3*cA*cA*H3)
+                                 +(kw*AR/(rho*Cp*VR))*(thetaK -theta));
+    f2 << dot(thetaK) == (1/tu)*((1/(mK*CPK))*(u2 + kw*AR*(theta-thetaK)));
+
+    compareModes( "cstr", f2 );
+
+
+    // Integrate the pendulum in both modes:
+    // -------------------------------------
+    DifferentialEquation f1Tape = f1;
+    f1Tape.setEvaluationMode( FEM_TAPE );
+
+    IntegratorBDF integratorTree( f1 );
+    IntegratorBDF integratorTape( f1Tape );
+
+    double x_start[2] = { 1.0, 0.0 };
+    double u      [1] = { 0.0      };
+    double p      [1] = { 1.0      };
+
+    double tic = acadoGetTime();
+    integratorTree.integrate( 0.0, 2.0, x_start, 0, p, u );
+    double tTree = acadoGetTime() - tic;
+
+    tic = acadoGetTime();
+    integratorTape.integrate( 0.0, 2.0, x_start, 0, p, u );
+    double tTape = acadoGetTime() - tic;
+
+    DVector xTree, xTape;
+    integratorTree.getX( xTree );
+    integratorTape.getX( xTape );
+
+    printf( "pendulum BDF integration: tree walker %.3e s, tape %.3e s, deviation %.3e\n",
+            tTree, tTape, DVector(xTree - xTape).getNorm( VN_LINF ) );
+
+    return 0;
+}
@@ -148,6 +148,42 @@ class QProblem : public QProblemB
 							);
 
 
+		/** Initialises a QProblem with given QP data and solves it starting from
+		 *	the given working sets of bounds and constraints (at most nWSR iterations).
+		 *	This allows to warm-start a QP whose matrices differ from the ones
+		 *	of the QP the working sets were obtained from.
+		 *	\return SUCCESSFUL_RETURN \n
+					RET_INIT_FAILED \n
+					RET_INIT_FAILED_CHOLESKY \n
+					RET_INIT_FAILED_TQ \n
+					RET_INIT_FAILED_HOTSTART \n
+					RET_INIT_FAILED_INFEASIBILITY \n
+					RET_INIT_FAILED_UNBOUNDEDNESS \n
+					RET_MAX_NWSR_REACHED \n
+					RET_INVALID_ARGUMENTS \n
+					RET_INACCURATE_SOLUTION \n
+		 			RET_NO_SOLUTION */
+		returnValue init(	const real_t* const _H, 		/**< Hessian matrix. */
+							const real_t* const _R, 		/**< Cholesky factorization of the Hessian matrix. \n
+																If it is not known, a NULL pointer can be passed. */
+							const real_t* const _g, 		/**< Gradient vector. */
+							const real_t* const _A,  		/**< Constraint matrix. */
+							const real_t* const _lb,		/**< Lower bound vector (on variables). \n
+																If no lower bounds exist, a NULL pointer can be passed. */
+							const real_t* const _ub,		/**< Upper bound vector (on variables). \n
+																If no upper bounds exist, a NULL pointer can be passed. */
+							const real_t* const _lbA,		/**< Lower constraints' bound vector. \n
+																If no lower constraints' bounds exist, a NULL pointer can be passed. */
+							const real_t* const _ubA,		/**< Upper constraints' bound vector. \n
+																If no lower constraints' bounds exist, a NULL pointer can be passed. */
+							int& nWSR,						/**< Input: Maximum number of working set recalculations when using initial homotopy.
+																Output: Number of performed working set recalculations. */
+							const Bounds* const guessedBounds,				/**< Guessed working set of bounds. */
+							const Constraints* const guessedConstraints,	/**< Guessed working set of constraints. */
+							real_t* const cputime = 0		/**< Output: CPU time required to initialise QP. */
+							);
+
+
 		/** Solves QProblem using online active set strategy.
 		 *	\return SUCCESSFUL_RETURN \n
 		 			RET_MAX_NWSR_REACHED \n
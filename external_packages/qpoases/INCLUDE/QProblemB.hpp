@@ -137,6 +137,35 @@ class QProblemB
 							);
 
 
+		/** Initialises a QProblemB with given QP data and solves it starting from
+		 *	the given working set of bounds (at most nWSR iterations).
+		 *	This allows to warm-start a QP whose Hessian differs from the one
+		 *	of the QP the working set was obtained from.
+		 *	\return SUCCESSFUL_RETURN \n
+					RET_INIT_FAILED \n
+					RET_INIT_FAILED_CHOLESKY \n
+					RET_INIT_FAILED_HOTSTART \n
+					RET_INIT_FAILED_INFEASIBILITY \n
+					RET_INIT_FAILED_UNBOUNDEDNESS \n
+					RET_MAX_NWSR_REACHED \n
+					RET_INVALID_ARGUMENTS \n
+					RET_INACCURATE_SOLUTION \n
+		 			RET_NO_SOLUTION */
+		returnValue init(	const real_t* const _H, 		/**< Hessian matrix. */
+							const real_t* const _R, 		/**< Cholesky factorization of the Hessian matrix. \n
+																If it is not known, a NULL pointer can be passed. */
+							const real_t* const _g,			/**< Gradient vector. */
+							const real_t* const _lb,		/**< Lower bounds (on variables). \n
+																If no lower bounds exist, a NULL pointer can be passed. */
+							const real_t* const _ub,		/**< Upper bounds (on variables). \n
+																If no upper bounds exist, a NULL pointer can be passed. */
+							int& nWSR, 						/**< Input: Maximum number of working set recalculations when using initial homotopy. \n
+																Output: Number of performed working set recalculations. */
+							const Bounds* const guessedBounds,	/**< Guessed working set of bounds. */
+				 			real_t* const cputime = 0		/**< Output: CPU time required to initialise QP. */
+							);
+
+
 		/** Solves an initialised QProblemB using online active set strategy.
 		 *	\return SUCCESSFUL_RETURN \n
 					RET_MAX_NWSR_REACHED \n
@@ -262,6 +262,21 @@ returnValue QProblem::init(	const real_t* const _H, const real_t* const _R, cons
 	return solveInitialQP( 0,yOpt,0,0, nWSR,cputime );
 }
 
+returnValue QProblem::init(	const real_t* const _H, const real_t* const _R, const real_t* const _g, const real_t* const _A,
+							const real_t* const _lb, const real_t* const _ub,
+							const real_t* const _lbA, const real_t* const _ubA,
+							int& nWSR, const Bounds* const guessedBounds, const Constraints* const guessedConstraints,
+							real_t* const cputime
+							)
+{
+	/* 1) Setup QP data. */
+	if (setupQPdata(_H, _R, _g, _A, _lb, _ub, _lbA, _ubA) != SUCCESSFUL_RETURN)
+		return THROWERROR( RET_INVALID_ARGUMENTS );
+
+	/* 2) Call to main initialisation routine, starting from the guessed working sets. */
+	return solveInitialQP( 0,0,guessedBounds,guessedConstraints, nWSR,cputime );
+}
+
 
 /*
  *	h o t s t a r t
@@ -842,11 +857,11 @@ returnValue QProblem::solveInitialQP(	const real_t* const xOpt, const real_t* co
 
 	/* 3) Obtain linear independent working set for auxiliary QP. */
 
-	static Bounds auxiliaryBounds;
+	Bounds auxiliaryBounds;
 
 	auxiliaryBounds.init( nV );
 
-	static Constraints auxiliaryConstraints;
+	Constraints auxiliaryConstraints;
 
 	auxiliaryConstraints.init( nC );
 
@@ -308,6 +308,19 @@ returnValue QProblemB::init(	const real_t* const _H, const real_t* const _R, con
 	return solveInitialQP(0, yOpt, 0, nWSR, cputime);
 }
 
+returnValue QProblemB::init(	const real_t* const _H, const real_t* const _R, const real_t* const _g,
+								const real_t* const _lb, const real_t* const _ub,
+								int& nWSR, const Bounds* const guessedBounds, real_t* const cputime
+								)
+{
+	/* 1) Setup QP data. */
+	if (setupQPdata(_H, _R, _g, _lb, _ub) != SUCCESSFUL_RETURN)
+		return THROWERROR( RET_INVALID_ARGUMENTS );
+
+	/* 2) Call to main initialisation routine, starting from the guessed working set. */
+	return solveInitialQP(0, 0, guessedBounds, nWSR, cputime);
+}
+
 
 /*
  *	h o t s t a r t
@@ -867,7 +880,7 @@ returnValue QProblemB::solveInitialQP(	const real_t* const xOpt, const real_t* c
 
 	/* 3) Obtain linear independent working set for auxiliary QP. */
 
-	static Bounds auxiliaryBounds;
+	Bounds auxiliaryBounds;
 
 	auxiliaryBounds.init( nV );
 